@@ -6,26 +6,39 @@
 
 #include <kernel/bitcoinkernel.h>
 
+#include <arith_uint256.h>
 #include <chain.h>
+#include <checkqueue.h>
 #include <coins.h>
 #include <consensus/validation.h>
+#include <crypto/common.h>
+#include <crypto/muhash.h>
 #include <dbwrapper.h>
+#include <flatfile.h>
+#include <hash.h>
 #include <kernel/caches.h>
 #include <kernel/chainparams.h>
 #include <kernel/checks.h>
+#include <kernel/coinstats.h>
 #include <kernel/context.h>
+#include <kernel/mempool_options.h>
 #include <kernel/notifications_interface.h>
 #include <kernel/warning.h>
 #include <logging.h>
 #include <node/blockstorage.h>
 #include <node/chainstate.h>
+#include <node/utxo_snapshot.h>
+#include <policy/packages.h>
 #include <primitives/block.h>
 #include <primitives/transaction.h>
 #include <script/interpreter.h>
 #include <script/script.h>
+#include <script/sigcache.h>
 #include <serialize.h>
 #include <streams.h>
 #include <sync.h>
+#include <tinyformat.h>
+#include <txmempool.h>
 #include <uint256.h>
 #include <undo.h>
 #include <util/check.h>
@@ -33,21 +46,32 @@
 #include <util/result.h>
 #include <util/signalinterrupt.h>
 #include <util/task_runner.h>
+#include <util/threadnames.h>
+#include <util/time.h>
 #include <util/translation.h>
 #include <validation.h>
 #include <validationinterface.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstring>
+#include <deque>
 #include <exception>
 #include <functional>
 #include <list>
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace Consensus {
@@ -218,6 +242,30 @@ btck_SynchronizationState cast_state(SynchronizationState state)
     assert(false);
 }
 
+btck_MempoolAcceptResult cast_mempool_accept_result(MempoolAcceptResult::ResultType result)
+{
+    switch (result) {
+    case MempoolAcceptResult::ResultType::VALID:
+        return btck_MempoolAcceptResult_VALID;
+    case MempoolAcceptResult::ResultType::INVALID:
+        return btck_MempoolAcceptResult_INVALID;
+    case MempoolAcceptResult::ResultType::MEMPOOL_ENTRY:
+        return btck_MempoolAcceptResult_MEMPOOL_ENTRY;
+    case MempoolAcceptResult::ResultType::DIFFERENT_WITNESS:
+        return btck_MempoolAcceptResult_DIFFERENT_WITNESS;
+    } // no default case, so the compiler can warn about missing cases
+    assert(false);
+}
+
+//! Passes the reason a transaction or package was rejected to the writer.
+template <typename Result>
+void WriteRejectReason(const ValidationState<Result>& state, btck_WriteBytes writer, void* user_data)
+{
+    if (!writer || state.IsValid()) return;
+    const std::string reason{state.ToString()};
+    (void)writer(reason.data(), reason.size(), user_data);
+}
+
 btck_Warning cast_btck_warning(kernel::Warning warning)
 {
     switch (warning) {
@@ -328,8 +376,236 @@ public:
     }
 };
 
+//! A block or header tip notification that may be held back.
+struct TipNotification {
+    SynchronizationState state;
+    bool presync;
+    int64_t height;
+    std::function<void()> deliver;
+};
+
+//! Delivers tip notifications at most once every interval and number of
+//! blocks, holding back the latest tip in between. A tip is delivered right
+//! away if its synchronization state differs from the last delivered one.
+//! Deliveries never run concurrently and never wait for one another, since
+//! block tips are notified while holding cs_main, which callbacks may need.
+class TipLimiter
+{
+    //! How long no newer tip has to arrive before the held back tip is
+    //! delivered regardless of the number of blocks.
+    static constexpr std::chrono::milliseconds IDLE_DELAY{100};
+
+    const std::chrono::milliseconds m_min_interval;
+    const int64_t m_min_blocks;
+
+    Mutex m_mutex;
+    std::condition_variable m_delivered_cv;
+    std::optional<TipNotification> m_pending GUARDED_BY(m_mutex);
+    SteadyClock::time_point m_pending_time GUARDED_BY(m_mutex);
+    //! Whether the pending tip arrived due while another tip was delivered.
+    bool m_pending_due GUARDED_BY(m_mutex){false};
+    bool m_delivering GUARDED_BY(m_mutex){false};
+    std::optional<std::pair<SynchronizationState, bool>> m_last_state GUARDED_BY(m_mutex);
+    int64_t m_last_height GUARDED_BY(m_mutex){0};
+    SteadyClock::time_point m_last_time GUARDED_BY(m_mutex);
+
+    bool IsDue(const TipNotification& tip) const EXCLUSIVE_LOCKS_REQUIRED(m_mutex)
+    {
+        if (m_last_state != std::pair{tip.state, tip.presync}) return true;
+        return SteadyClock::now() - m_last_time >= m_min_interval &&
+               (tip.height < m_last_height || tip.height - m_last_height >= m_min_blocks);
+    }
+
+    //! When the held back tip is delivered if no newer tip arrives.
+    SteadyClock::time_point HeldBackDue() const EXCLUSIVE_LOCKS_REQUIRED(m_mutex)
+    {
+        return std::max(m_last_time + m_min_interval, m_pending_time + IDLE_DELAY);
+    }
+
+    //! Delivers the tip, followed by any tip that arrived due meanwhile.
+    void Deliver(UniqueLock<Mutex>& lock, TipNotification tip) EXCLUSIVE_LOCKS_REQUIRED(m_mutex)
+    {
+        m_delivering = true;
+        while (true) {
+            m_last_state = std::pair{tip.state, tip.presync};
+            m_last_height = tip.height;
+            m_last_time = SteadyClock::now();
+            {
+                REVERSE_LOCK(lock, m_mutex);
+                tip.deliver();
+            }
+            if (!m_pending || !m_pending_due) break;
+            tip = std::move(*m_pending);
+            m_pending.reset();
+            m_pending_due = false;
+        }
+        m_delivering = false;
+        m_delivered_cv.notify_all();
+    }
+
+public:
+    TipLimiter(std::chrono::milliseconds min_interval, int64_t min_blocks)
+        : m_min_interval{min_interval}, m_min_blocks{min_blocks} {}
+
+    void Notify(TipNotification tip) EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        WAIT_LOCK(m_mutex, lock);
+        const bool due{IsDue(tip)};
+        if (!due || m_delivering) {
+            m_pending = std::move(tip);
+            m_pending_time = SteadyClock::now();
+            m_pending_due = due;
+            return;
+        }
+        m_pending.reset();
+        Deliver(lock, std::move(tip));
+    }
+
+    //! Delivers the held back tip once the interval since the last delivery
+    //! passed and no newer tip arrived for IDLE_DELAY, regardless of the
+    //! number of blocks. If forced, it is delivered right away, after waiting
+    //! for an ongoing delivery.
+    void DeliverHeldBack(bool force = false) EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        WAIT_LOCK(m_mutex, lock);
+        if (force) m_delivered_cv.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return !m_delivering; });
+        if (!m_pending || m_delivering) return;
+        if (!force && SteadyClock::now() < HeldBackDue()) return;
+        auto tip{std::move(*m_pending)};
+        m_pending.reset();
+        m_pending_due = false;
+        Deliver(lock, std::move(tip));
+    }
+
+    //! Returns when the held back tip is due, if any.
+    std::optional<SteadyClock::time_point> HeldBackDeadline() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        LOCK(m_mutex);
+        if (!m_pending) return std::nullopt;
+        return HeldBackDue();
+    }
+};
+
+//! Forwards notifications to KernelNotifications, rate limiting the block and
+//! header tips. A worker thread delivers the latest held back tip once
+//! validation went idle, so it is not held back indefinitely.
+class TipLimitedNotifications final : public kernel::Notifications
+{
+    const std::shared_ptr<KernelNotifications> m_notifications;
+    TipLimiter m_block_tips;
+    TipLimiter m_header_tips;
+
+    Mutex m_mutex;
+    std::condition_variable m_worker_cv;
+    bool m_tip_held_back GUARDED_BY(m_mutex){false};
+    bool m_worker_idle GUARDED_BY(m_mutex){false};
+    bool m_request_stop GUARDED_BY(m_mutex){false};
+    std::thread m_worker_thread;
+
+    void WakeWorker() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        LOCK(m_mutex);
+        m_tip_held_back = true;
+        // While waiting for a held back tip to become due, newer tips do not
+        // need to wake the worker, which keeps it off the path of every block.
+        if (m_worker_idle) m_worker_cv.notify_one();
+    }
+
+    void Loop() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        WAIT_LOCK(m_mutex, lock);
+        while (!m_request_stop) {
+            m_tip_held_back = false;
+            m_worker_idle = false;
+            std::optional<SteadyClock::time_point> deadline;
+            {
+                REVERSE_LOCK(lock, m_mutex);
+                m_block_tips.DeliverHeldBack();
+                m_header_tips.DeliverHeldBack();
+                for (const auto& tip_deadline : {m_block_tips.HeldBackDeadline(), m_header_tips.HeldBackDeadline()}) {
+                    if (tip_deadline && (!deadline || *tip_deadline < *deadline)) deadline = tip_deadline;
+                }
+            }
+            if (deadline) {
+                m_worker_cv.wait_until(lock, *deadline, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_request_stop; });
+            } else if (!m_tip_held_back) {
+                m_worker_idle = true;
+                m_worker_cv.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_request_stop || m_tip_held_back; });
+            }
+        }
+    }
+
+public:
+    TipLimitedNotifications(std::shared_ptr<KernelNotifications> notifications, std::chrono::milliseconds min_interval, int64_t min_blocks)
+        : m_notifications{std::move(notifications)},
+          m_block_tips{min_interval, min_blocks},
+          m_header_tips{min_interval, min_blocks}
+    {
+        m_worker_thread = std::thread{[this]() {
+            util::ThreadRename("tipnotify");
+            Loop();
+        }};
+    }
+
+    TipLimitedNotifications(const TipLimitedNotifications&) = delete;
+    TipLimitedNotifications& operator=(const TipLimitedNotifications&) = delete;
+
+    //! Delivers the held back tips, e.g. before the block tree entries they
+    //! refer to are destroyed.
+    void DeliverHeldBack() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        m_block_tips.DeliverHeldBack(/*force=*/true);
+        m_header_tips.DeliverHeldBack(/*force=*/true);
+    }
+
+    kernel::InterruptResult blockTip(SynchronizationState state, const CBlockIndex& index, double verification_progress) override
+    {
+        m_block_tips.Notify({state, false, index.nHeight, [notifications = m_notifications, state, &index, verification_progress]() {
+                                 (void)notifications->blockTip(state, index, verification_progress);
+                             }});
+        WakeWorker();
+        return {};
+    }
+    void headerTip(SynchronizationState state, int64_t height, int64_t timestamp, bool presync) override
+    {
+        m_header_tips.Notify({state, presync, height, [notifications = m_notifications, state, height, timestamp, presync]() {
+                                  notifications->headerTip(state, height, timestamp, presync);
+                              }});
+        WakeWorker();
+    }
+    void progress(const bilingual_str& title, int progress_percent, bool resume_possible) override
+    {
+        m_notifications->progress(title, progress_percent, resume_possible);
+    }
+    void warningSet(kernel::Warning id, const bilingual_str& message) override
+    {
+        m_notifications->warningSet(id, message);
+    }
+    void warningUnset(kernel::Warning id) override
+    {
+        m_notifications->warningUnset(id);
+    }
+    void flushError(const bilingual_str& message) override
+    {
+        m_notifications->flushError(message);
+    }
+    void fatalError(const bilingual_str& message) override
+    {
+        m_notifications->fatalError(message);
+    }
+
+    ~TipLimitedNotifications()
+    {
+        WITH_LOCK(m_mutex, m_request_stop = true);
+        m_worker_cv.notify_one();
+        m_worker_thread.join();
+    }
+};
+
 class KernelValidationInterface final : public CValidationInterface
 {
+    friend class QueuedValidationInterface;
+
 public:
     btck_ValidationInterfaceCallbacks m_cbs;
 
@@ -345,6 +621,8 @@ public:
     }
 
 protected:
+    // The borrowed callbacks get a handle to the event's shared pointer, which
+    // outlives the callback.
     void BlockChecked(const std::shared_ptr<const CBlock>& block, const BlockValidationState& stateIn) override
     {
         if (m_cbs.block_checked) {
@@ -352,6 +630,11 @@ protected:
                                 btck_Block::copy(btck_Block::ref(&block)),
                                 btck_BlockValidationState::ref(&stateIn));
         }
+        if (m_cbs.borrowed_block_checked) {
+            m_cbs.borrowed_block_checked(m_cbs.user_data,
+                                         btck_Block::ref(&block),
+                                         btck_BlockValidationState::ref(&stateIn));
+        }
     }
 
     void NewPoWValidBlock(const CBlockIndex* pindex, const std::shared_ptr<const CBlock>& block) override
@@ -361,6 +644,11 @@ protected:
                                   btck_Block::copy(btck_Block::ref(&block)),
                                   btck_BlockTreeEntry::ref(pindex));
         }
+        if (m_cbs.borrowed_pow_valid_block) {
+            m_cbs.borrowed_pow_valid_block(m_cbs.user_data,
+                                           btck_Block::ref(&block),
+                                           btck_BlockTreeEntry::ref(pindex));
+        }
     }
 
     void BlockConnected(const ChainstateRole& role, const std::shared_ptr<const CBlock>& block, const CBlockIndex* pindex) override
@@ -370,6 +658,11 @@ protected:
                                   btck_Block::copy(btck_Block::ref(&block)),
                                   btck_BlockTreeEntry::ref(pindex));
         }
+        if (m_cbs.borrowed_block_connected) {
+            m_cbs.borrowed_block_connected(m_cbs.user_data,
+                                           btck_Block::ref(&block),
+                                           btck_BlockTreeEntry::ref(pindex));
+        }
     }
 
     void BlockDisconnected(const std::shared_ptr<const CBlock>& block, const CBlockIndex* pindex) override
@@ -379,14 +672,154 @@ protected:
                                      btck_Block::copy(btck_Block::ref(&block)),
                                      btck_BlockTreeEntry::ref(pindex));
         }
+        if (m_cbs.borrowed_block_disconnected) {
+            m_cbs.borrowed_block_disconnected(m_cbs.user_data,
+                                              btck_Block::ref(&block),
+                                              btck_BlockTreeEntry::ref(pindex));
+        }
+    }
+};
+
+//! Number of pending callbacks above which validation waits for the validation
+//! interface queue to drain before connecting more blocks, see
+//! LimitValidationInterfaceQueue in validation.cpp.
+constexpr size_t VALIDATION_QUEUE_WAIT_THRESHOLD{10};
+
+//! Runs validation interface callbacks one at a time on a worker thread,
+//! queueing up to a fixed number of them.
+class QueuedTaskRunner final : public util::TaskRunnerInterface
+{
+    const size_t m_capacity;
+    const btck_ValidationQueueOverflow m_overflow;
+
+    Mutex m_mutex;
+    std::condition_variable m_worker_cv;
+    std::condition_variable m_flush_cv;
+    std::deque<std::function<void()>> m_tasks GUARDED_BY(m_mutex);
+    bool m_running_task GUARDED_BY(m_mutex){false};
+    bool m_request_stop GUARDED_BY(m_mutex){false};
+    std::thread m_worker_thread;
+
+    void Loop() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        WAIT_LOCK(m_mutex, lock);
+        while (true) {
+            m_worker_cv.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_request_stop || !m_tasks.empty(); });
+            // Callbacks queued before stopping are still delivered.
+            if (m_tasks.empty()) return;
+            auto task{std::move(m_tasks.front())};
+            m_tasks.pop_front();
+            m_running_task = true;
+            {
+                REVERSE_LOCK(lock, m_mutex);
+                task();
+            }
+            m_running_task = false;
+            if (m_tasks.empty()) m_flush_cv.notify_all();
+        }
+    }
+
+public:
+    QueuedTaskRunner(size_t capacity, btck_ValidationQueueOverflow overflow)
+        : m_capacity{capacity},
+          m_overflow{overflow},
+          m_worker_thread{[this]() {
+              util::ThreadRename("validationqueue");
+              Loop();
+          }} {}
+
+    QueuedTaskRunner(const QueuedTaskRunner&) = delete;
+    QueuedTaskRunner& operator=(const QueuedTaskRunner&) = delete;
+
+    void insert(std::function<void()> func) override EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        LOCK(m_mutex);
+        if (m_overflow == btck_ValidationQueueOverflow_DROP_OLDEST && m_tasks.size() >= m_capacity) {
+            m_tasks.pop_front();
+        }
+        m_tasks.push_back(std::move(func));
+        m_worker_cv.notify_one();
+    }
+
+    //! Waits until all queued callbacks were run.
+    void flush() override EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        WAIT_LOCK(m_mutex, lock);
+        m_flush_cv.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_tasks.empty() && !m_running_task; });
+    }
+
+    //! Inserting never waits, since callbacks are issued while holding
+    //! cs_main, which the callbacks may need. Instead, once the queue is full,
+    //! the size is reported above the threshold at which validation waits for
+    //! the queue to drain outside of cs_main. Dropping callbacks never waits,
+    //! so the queue is then reported as empty, which also ensures the
+    //! undroppable sync marker validation would insert is never needed.
+    size_t size() override EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        LOCK(m_mutex);
+        if (m_overflow == btck_ValidationQueueOverflow_DROP_OLDEST || m_tasks.size() < m_capacity) return 0;
+        return std::max(m_tasks.size(), VALIDATION_QUEUE_WAIT_THRESHOLD + 1);
+    }
+
+    ~QueuedTaskRunner()
+    {
+        WITH_LOCK(m_mutex, m_request_stop = true);
+        m_worker_cv.notify_one();
+        m_worker_thread.join();
+    }
+};
+
+//! Forwards validation interface callbacks to a KernelValidationInterface.
+//! Validation issues block_checked and pow_valid_block synchronously, so they
+//! are queued here, while the other callbacks already arrive through the queue.
+class QueuedValidationInterface final : public CValidationInterface
+{
+    const std::shared_ptr<KernelValidationInterface> m_interface;
+    util::TaskRunnerInterface& m_task_runner;
+
+public:
+    QueuedValidationInterface(std::shared_ptr<KernelValidationInterface> interface, util::TaskRunnerInterface& task_runner)
+        : m_interface{std::move(interface)}, m_task_runner{task_runner} {}
+
+protected:
+    void BlockChecked(const std::shared_ptr<const CBlock>& block, const BlockValidationState& state) override
+    {
+        m_task_runner.insert([interface = m_interface, block, state]() { interface->BlockChecked(block, state); });
+    }
+
+    void NewPoWValidBlock(const CBlockIndex* pindex, const std::shared_ptr<const CBlock>& block) override
+    {
+        m_task_runner.insert([interface = m_interface, pindex, block]() { interface->NewPoWValidBlock(pindex, block); });
+    }
+
+    void BlockConnected(const ChainstateRole& role, const std::shared_ptr<const CBlock>& block, const CBlockIndex* pindex) override
+    {
+        m_interface->BlockConnected(role, block, pindex);
+    }
+
+    void BlockDisconnected(const std::shared_ptr<const CBlock>& block, const CBlockIndex* pindex) override
+    {
+        m_interface->BlockDisconnected(block, pindex);
     }
 };
 
+struct ValidationQueueOptions {
+    size_t capacity;
+    btck_ValidationQueueOverflow overflow;
+};
+
+struct TipNotificationLimit {
+    std::chrono::milliseconds min_interval;
+    int64_t min_blocks;
+};
+
 struct ContextOptions {
     mutable Mutex m_mutex;
     std::unique_ptr<const CChainParams> m_chainparams GUARDED_BY(m_mutex);
     std::shared_ptr<KernelNotifications> m_notifications GUARDED_BY(m_mutex);
     std::shared_ptr<KernelValidationInterface> m_validation_interface GUARDED_BY(m_mutex);
+    std::optional<ValidationQueueOptions> m_validation_queue GUARDED_BY(m_mutex);
+    std::optional<TipNotificationLimit> m_tip_notification_limit GUARDED_BY(m_mutex);
 };
 
 class Context
@@ -396,13 +829,18 @@ public:
 
     std::shared_ptr<KernelNotifications> m_notifications;
 
+    //! Rate limits the tips passed to m_notifications, if configured.
+    std::shared_ptr<TipLimitedNotifications> m_tip_limited_notifications;
+
     std::unique_ptr<util::SignalInterrupt> m_interrupt;
 
     std::unique_ptr<ValidationSignals> m_signals;
 
     std::unique_ptr<const CChainParams> m_chainparams;
 
-    std::shared_ptr<KernelValidationInterface> m_validation_interface;
+    //! The interface registered with m_signals, which forwards to the user's
+    //! callbacks.
+    std::shared_ptr<CValidationInterface> m_validation_interface;
 
     Context(const ContextOptions* options, bool& sane)
         : m_context{std::make_unique<kernel::Context>()},
@@ -416,7 +854,12 @@ public:
             if (options->m_notifications) {
                 m_notifications = options->m_notifications;
             }
-            if (options->m_validation_interface) {
+            if (options->m_validation_interface && options->m_validation_queue) {
+                auto task_runner{std::make_unique<QueuedTaskRunner>(options->m_validation_queue->capacity, options->m_validation_queue->overflow)};
+                m_validation_interface = std::make_shared<QueuedValidationInterface>(options->m_validation_interface, *task_runner);
+                m_signals = std::make_unique<ValidationSignals>(std::move(task_runner));
+                m_signals->RegisterSharedValidationInterface(m_validation_interface);
+            } else if (options->m_validation_interface) {
                 m_signals = std::make_unique<ValidationSignals>(std::make_unique<ImmediateTaskRunner>());
                 m_validation_interface = options->m_validation_interface;
                 m_signals->RegisterSharedValidationInterface(m_validation_interface);
@@ -430,15 +873,29 @@ public:
             m_notifications = std::make_shared<KernelNotifications>(btck_NotificationInterfaceCallbacks{
                 nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr});
         }
+        if (options) {
+            LOCK(options->m_mutex);
+            if (const auto& limit{options->m_tip_notification_limit}) {
+                m_tip_limited_notifications = std::make_shared<TipLimitedNotifications>(m_notifications, limit->min_interval, limit->min_blocks);
+            }
+        }
 
         if (!kernel::SanityChecks(*m_context)) {
             sane = false;
         }
     }
 
+    //! The notifications passed to validation.
+    kernel::Notifications& Notifications() const
+    {
+        if (m_tip_limited_notifications) return *m_tip_limited_notifications;
+        return *m_notifications;
+    }
+
     ~Context()
     {
         if (m_signals) {
+            m_signals->FlushBackgroundCallbacks();
             m_signals->UnregisterSharedValidationInterface(m_validation_interface);
         }
     }
@@ -451,17 +908,20 @@ struct ChainstateManagerOptions {
     node::BlockManager::Options m_blockman_options GUARDED_BY(m_mutex);
     std::shared_ptr<const Context> m_context;
     node::ChainstateLoadOptions m_chainstate_load_options GUARDED_BY(m_mutex);
+    kernel::CacheSizes m_cache_sizes GUARDED_BY(m_mutex){DEFAULT_KERNEL_CACHE};
+    //! Set if the chainstate manager hosts a mempool.
+    std::optional<kernel::MemPoolOptions> m_mempool_options GUARDED_BY(m_mutex);
 
     ChainstateManagerOptions(const std::shared_ptr<const Context>& context, const fs::path& data_dir, const fs::path& blocks_dir)
         : m_chainman_options{ChainstateManager::Options{
               .chainparams = *context->m_chainparams,
               .datadir = data_dir,
-              .notifications = *context->m_notifications,
+              .notifications = context->Notifications(),
               .signals = context->m_signals.get()}},
           m_blockman_options{node::BlockManager::Options{
               .chainparams = *context->m_chainparams,
               .blocks_dir = blocks_dir,
-              .notifications = *context->m_notifications,
+              .notifications = context->Notifications(),
               .block_tree_db_params = DBParams{
                   .path = data_dir / "blocks" / "index",
                   .cache_bytes = kernel::CacheSizes{DEFAULT_KERNEL_CACHE}.block_tree_db,
@@ -471,95 +931,1174 @@ struct ChainstateManagerOptions {
     }
 };
 
+struct CoinsCursor;
+
+//! Tracks the live coins cursors of a chainstate manager, so that their
+//! database iterators can be released before the chainstate database is closed.
+struct CoinsCursorRegistry {
+    Mutex m_mutex;
+    std::set<CoinsCursor*> m_cursors GUARDED_BY(m_mutex);
+
+    //! Releases the database iterators of all cursors, after which reading
+    //! from them fails.
+    void ReleaseAll() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex);
+};
+
+class BlockRangeReader;
+
+//! Tracks the live block range readers of a chainstate manager, so that their
+//! worker threads can be stopped before the block manager is destroyed.
+struct BlockRangeReaderRegistry {
+    Mutex m_mutex;
+    std::set<BlockRangeReader*> m_readers GUARDED_BY(m_mutex);
+};
+
+//! Processes submitted blocks one at a time in submission order on a worker
+//! thread, reporting the result of each through its completion callback.
+class BlockSubmitQueue
+{
+    struct Submission {
+        std::shared_ptr<const CBlock> block;
+        btck_BlockProcessed done;
+        void* user_data;
+    };
+
+    ChainstateManager& m_chainman;
+    Mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Submission> m_submissions GUARDED_BY(m_mutex);
+    bool m_request_stop GUARDED_BY(m_mutex){false};
+    std::thread m_worker_thread;
+
+    void Loop() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        while (true) {
+            Submission submission;
+            {
+                WAIT_LOCK(m_mutex, lock);
+                m_cv.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_request_stop || !m_submissions.empty(); });
+                // Blocks submitted before stopping are still processed.
+                if (m_submissions.empty()) return;
+                submission = std::move(m_submissions.front());
+                m_submissions.pop_front();
+            }
+            bool new_block{false};
+            bool processed{false};
+            try {
+                processed = m_chainman.ProcessNewBlock(submission.block, /*force_processing=*/true, /*min_pow_checked=*/true, &new_block);
+            } catch (const std::exception& e) {
+                LogError("Failed to process submitted block: %s", e.what());
+            }
+            if (submission.done) submission.done(submission.user_data, processed ? 0 : -1, new_block ? 1 : 0);
+        }
+    }
+
+public:
+    explicit BlockSubmitQueue(ChainstateManager& chainman)
+        : m_chainman{chainman},
+          m_worker_thread{[this]() {
+              util::ThreadRename("blocksubmit");
+              Loop();
+          }} {}
+
+    BlockSubmitQueue(const BlockSubmitQueue&) = delete;
+    BlockSubmitQueue& operator=(const BlockSubmitQueue&) = delete;
+
+    bool IsWorkerThread() const
+    {
+        return std::this_thread::get_id() == m_worker_thread.get_id();
+    }
+
+    void Submit(std::shared_ptr<const CBlock> block, btck_BlockProcessed done, void* user_data) EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        LOCK(m_mutex);
+        m_submissions.push_back({std::move(block), done, user_data});
+        m_cv.notify_one();
+    }
+
+    ~BlockSubmitQueue()
+    {
+        WITH_LOCK(m_mutex, m_request_stop = true);
+        m_cv.notify_one();
+        m_worker_thread.join();
+    }
+};
+
 struct ChainMan {
+    //! Outlives m_chainman, whose chainstates refer to it.
+    std::unique_ptr<CTxMemPool> m_mempool;
     std::unique_ptr<ChainstateManager> m_chainman;
     std::shared_ptr<const Context> m_context;
+    std::shared_ptr<CoinsCursorRegistry> m_coins_cursors{std::make_shared<CoinsCursorRegistry>()};
+    std::shared_ptr<BlockRangeReaderRegistry> m_block_readers{std::make_shared<BlockRangeReaderRegistry>()};
+    Mutex m_submit_mutex;
+    //! Created on the first submitted block.
+    std::unique_ptr<BlockSubmitQueue> m_submit_queue GUARDED_BY(m_submit_mutex);
+    //! Set once the chainstate manager is being destroyed, after which blocks
+    //! can no longer be submitted.
+    bool m_destroying GUARDED_BY(m_submit_mutex){false};
+
+    ChainMan(std::unique_ptr<ChainstateManager> chainman, std::shared_ptr<const Context> context, std::unique_ptr<CTxMemPool> mempool = nullptr)
+        : m_mempool(std::move(mempool)), m_chainman(std::move(chainman)), m_context(std::move(context)) {}
+};
 
-    ChainMan(std::unique_ptr<ChainstateManager> chainman, std::shared_ptr<const Context> context)
-        : m_chainman(std::move(chainman)), m_context(std::move(context)) {}
+//! Signature and script execution caches shared by standalone script
+//! verification calls.
+struct ScriptCaches {
+    ValidationCache m_cache;
+    //! Guards m_cache.m_script_execution_cache, which requires external
+    //! locking. The signature cache does its own locking.
+    Mutex m_mutex;
+    std::atomic<uint64_t> m_hits{0};
+
+    ScriptCaches(size_t signature_cache_bytes, size_t script_execution_cache_bytes)
+        : m_cache{script_execution_cache_bytes, signature_cache_bytes} {}
 };
 
-} // namespace
+//! Looks up valid signatures in, and adds them to, the signature cache.
+//! Unlike CachingTransactionSignatureChecker, it fails instead of asserting
+//! when precomputed data is missing, so that every input can use the cache,
+//! and it does not need mutable precomputed data.
+class CachingSignatureChecker : public TransactionSignatureChecker
+{
+    ScriptCaches& m_caches;
 
-struct btck_Transaction : Handle<btck_Transaction, std::shared_ptr<const CTransaction>> {};
-struct btck_TransactionOutput : Handle<btck_TransactionOutput, CTxOut> {};
-struct btck_ScriptPubkey : Handle<btck_ScriptPubkey, CScript> {};
-struct btck_LoggingConnection : Handle<btck_LoggingConnection, LoggingConnection> {};
-struct btck_ContextOptions : Handle<btck_ContextOptions, ContextOptions> {};
-struct btck_Context : Handle<btck_Context, std::shared_ptr<const Context>> {};
-struct btck_ChainParameters : Handle<btck_ChainParameters, CChainParams> {};
-struct btck_ChainstateManagerOptions : Handle<btck_ChainstateManagerOptions, ChainstateManagerOptions> {};
-struct btck_ChainstateManager : Handle<btck_ChainstateManager, ChainMan> {};
-struct btck_Chain : Handle<btck_Chain, CChain> {};
-struct btck_BlockSpentOutputs : Handle<btck_BlockSpentOutputs, std::shared_ptr<CBlockUndo>> {};
-struct btck_TransactionSpentOutputs : Handle<btck_TransactionSpentOutputs, CTxUndo> {};
-struct btck_Coin : Handle<btck_Coin, Coin> {};
-struct btck_BlockHash : Handle<btck_BlockHash, uint256> {};
-struct btck_TransactionInput : Handle<btck_TransactionInput, CTxIn> {};
-struct btck_TransactionOutPoint: Handle<btck_TransactionOutPoint, COutPoint> {};
-struct btck_Txid: Handle<btck_Txid, Txid> {};
-struct btck_PrecomputedTransactionData : Handle<btck_PrecomputedTransactionData, PrecomputedTransactionData> {};
-struct btck_BlockHeader: Handle<btck_BlockHeader, CBlockHeader> {};
-struct btck_ConsensusParams: Handle<btck_ConsensusParams, Consensus::Params> {};
+    template <typename Verify>
+    bool VerifyCached(const uint256& entry, Verify verify) const
+    {
+        if (m_caches.m_cache.m_signature_cache.Get(entry, /*erase=*/false)) {
+            ++m_caches.m_hits;
+            return true;
+        }
+        if (!verify()) return false;
+        m_caches.m_cache.m_signature_cache.Set(entry);
+        return true;
+    }
 
-btck_Transaction* btck_transaction_create(const void* raw_transaction, size_t raw_transaction_len)
-{
-    if (raw_transaction == nullptr && raw_transaction_len != 0) {
-        return nullptr;
+public:
+    CachingSignatureChecker(const CTransaction& tx, unsigned int input_index, CAmount amount, const PrecomputedTransactionData& txdata, ScriptCaches& caches)
+        : TransactionSignatureChecker(&tx, input_index, amount, txdata, MissingDataBehavior::FAIL), m_caches{caches} {}
+
+    bool VerifyECDSASignature(const std::vector<unsigned char>& sig, const CPubKey& pubkey, const uint256& sighash) const override
+    {
+        uint256 entry;
+        m_caches.m_cache.m_signature_cache.ComputeEntryECDSA(entry, sighash, sig, pubkey);
+        return VerifyCached(entry, [&] { return TransactionSignatureChecker::VerifyECDSASignature(sig, pubkey, sighash); });
     }
-    try {
-        SpanReader stream{std::span{reinterpret_cast<const std::byte*>(raw_transaction), raw_transaction_len}};
-        return btck_Transaction::create(std::make_shared<const CTransaction>(deserialize, TX_WITH_WITNESS, stream));
-    } catch (...) {
-        return nullptr;
+
+    bool VerifySchnorrSignature(std::span<const unsigned char> sig, const XOnlyPubKey& pubkey, const uint256& sighash) const override
+    {
+        uint256 entry;
+        m_caches.m_cache.m_signature_cache.ComputeEntrySchnorr(entry, sighash, sig, pubkey);
+        return VerifyCached(entry, [&] { return TransactionSignatureChecker::VerifySchnorrSignature(sig, pubkey, sighash); });
     }
-}
+};
 
-size_t btck_transaction_count_outputs(const btck_Transaction* transaction)
+bool VerifyInput(const CTransaction& tx, unsigned int input_index, const CScript& script_pubkey, CAmount amount,
+                 const PrecomputedTransactionData& txdata, script_verify_flags flags, ScriptCaches* caches)
 {
-    return btck_Transaction::get(transaction)->vout.size();
+    const CTxIn& input{tx.vin[input_index]};
+    if (caches) {
+        return VerifyScript(input.scriptSig, script_pubkey, &input.scriptWitness, flags,
+                            CachingSignatureChecker(tx, input_index, amount, txdata, *caches),
+                            nullptr);
+    }
+    return VerifyScript(input.scriptSig, script_pubkey, &input.scriptWitness, flags,
+                        TransactionSignatureChecker(&tx, input_index, amount, txdata, MissingDataBehavior::FAIL),
+                        nullptr);
 }
 
-const btck_TransactionOutput* btck_transaction_get_output_at(const btck_Transaction* transaction, size_t output_index)
+//! Verifies a single transaction input. Records the outcome instead of
+//! reporting a failure to the check queue, so that the remaining inputs are
+//! still verified.
+class InputCheck
 {
-    const CTransaction& tx = *btck_Transaction::get(transaction);
-    assert(output_index < tx.vout.size());
-    return btck_TransactionOutput::ref(&tx.vout[output_index]);
-}
+    const CTransaction* m_tx;
+    const PrecomputedTransactionData* m_txdata;
+    const CTxOut* m_spent_output;
+    unsigned int m_input_index;
+    script_verify_flags m_flags;
+    ScriptCaches* m_caches;
+    int* m_result;
 
-size_t btck_transaction_count_inputs(const btck_Transaction* transaction)
-{
-    return btck_Transaction::get(transaction)->vin.size();
-}
+public:
+    InputCheck(const CTransaction& tx, const PrecomputedTransactionData& txdata, unsigned int input_index, script_verify_flags flags, ScriptCaches* caches, int& result)
+        : m_tx{&tx}, m_txdata{&txdata}, m_spent_output{&txdata.m_spent_outputs[input_index]}, m_input_index{input_index}, m_flags{flags}, m_caches{caches}, m_result{&result} {}
 
-const btck_TransactionInput* btck_transaction_get_input_at(const btck_Transaction* transaction, size_t input_index)
-{
-    assert(input_index < btck_Transaction::get(transaction)->vin.size());
-    return btck_TransactionInput::ref(&btck_Transaction::get(transaction)->vin[input_index]);
-}
+    std::optional<std::monostate> operator()() const
+    {
+        *m_result = VerifyInput(*m_tx, m_input_index, m_spent_output->scriptPubKey, m_spent_output->nValue, *m_txdata, m_flags, m_caches) ? 1 : 0;
+        return std::nullopt;
+    }
+};
 
-uint32_t btck_transaction_get_locktime(const btck_Transaction* transaction)
-{
-    return btck_Transaction::get(transaction)->nLockTime;
-}
+struct CoinsCursor {
+    std::shared_ptr<CoinsCursorRegistry> m_registry;
+    Mutex m_mutex;
+    //! Reset when the chainstate database is closed before the cursor is
+    //! destroyed, e.g. when its cache is resized on snapshot activation.
+    std::unique_ptr<CCoinsViewCursor> m_cursor GUARDED_BY(m_mutex);
+    //! Exclusive upper bound of the shard, if it is not the last one.
+    const std::optional<Txid> m_end;
+    const uint256 m_best_block;
+
+    CoinsCursor(std::shared_ptr<CoinsCursorRegistry> registry, std::unique_ptr<CCoinsViewCursor> cursor, std::optional<Txid> end)
+        : m_registry{std::move(registry)}, m_cursor{std::move(cursor)}, m_end{std::move(end)}, m_best_block{m_cursor->GetBestBlock()}
+    {
+        LOCK(m_registry->m_mutex);
+        m_registry->m_cursors.insert(this);
+    }
 
-const btck_Txid* btck_transaction_get_txid(const btck_Transaction* transaction)
+    ~CoinsCursor()
+    {
+        LOCK(m_registry->m_mutex);
+        m_registry->m_cursors.erase(this);
+        LOCK(m_mutex);
+        m_cursor.reset();
+    }
+};
+
+void CoinsCursorRegistry::ReleaseAll()
 {
-    return btck_Txid::ref(&btck_Transaction::get(transaction)->GetHash());
+    LOCK(m_mutex);
+    for (CoinsCursor* cursor : m_cursors) {
+        LOCK(cursor->m_mutex);
+        cursor->m_cursor.reset();
+    }
+    m_cursors.clear();
 }
 
-btck_Transaction* btck_transaction_copy(const btck_Transaction* transaction)
+//! Opens a cursor into the chainstate database positioned at start. The
+//! cursors of the registry are released before the database is closed, which
+//! happens when its cache is resized, as well as when the chainstate is
+//! destroyed.
+std::unique_ptr<CCoinsViewCursor> OpenCoinsCursor(Chainstate& chainstate, const std::shared_ptr<CoinsCursorRegistry>& registry, const Txid& start) EXCLUSIVE_LOCKS_REQUIRED(::cs_main)
 {
-    return btck_Transaction::copy(transaction);
+    chainstate.CoinsDB().SetBeforeClose([registry] { registry->ReleaseAll(); });
+    return chainstate.CoinsDB().Cursor(start);
 }
 
-int btck_transaction_to_bytes(const btck_Transaction* transaction, btck_WriteBytes writer, void* user_data)
+//! Registered cursor for scans of the chainstate database within the
+//! library. It throws once the database was closed, so that a scan cannot end
+//! early without noticing.
+class RegisteredCoinsViewCursor final : public CCoinsViewCursor
 {
-    try {
-        WriterStream ws{writer, user_data};
-        ws << TX_WITH_WITNESS(btck_Transaction::get(transaction));
-        return 0;
-    } catch (...) {
+    mutable CoinsCursor m_cursor;
+
+    CCoinsViewCursor& Get() const EXCLUSIVE_LOCKS_REQUIRED(m_cursor.m_mutex)
+    {
+        if (!m_cursor.m_cursor) throw std::runtime_error("The chainstate database was closed");
+        return *m_cursor.m_cursor;
+    }
+
+public:
+    RegisteredCoinsViewCursor(std::shared_ptr<CoinsCursorRegistry> registry, std::unique_ptr<CCoinsViewCursor> cursor)
+        : CCoinsViewCursor{cursor->GetBestBlock()}, m_cursor{std::move(registry), std::move(cursor), std::nullopt} {}
+
+    bool GetKey(COutPoint& key) const override { return WITH_LOCK(m_cursor.m_mutex, return Get().GetKey(key)); }
+    bool GetValue(Coin& coin) const override { return WITH_LOCK(m_cursor.m_mutex, return Get().GetValue(coin)); }
+    bool Valid() const override { return WITH_LOCK(m_cursor.m_mutex, return Get().Valid()); }
+    void Next() override { WITH_LOCK(m_cursor.m_mutex, Get().Next()); }
+};
+
+//! Hands out a single cursor opened beforehand, so that Bitcoin Core's UTXO
+//! set scans can read through a registered cursor.
+class SingleCursorCoinsView final : public CoinsViewEmpty
+{
+    mutable std::unique_ptr<CCoinsViewCursor> m_cursor;
+
+public:
+    explicit SingleCursorCoinsView(std::unique_ptr<CCoinsViewCursor> cursor) : m_cursor{std::move(cursor)} {}
+
+    std::unique_ptr<CCoinsViewCursor> Cursor() const override { return std::move(m_cursor); }
+};
+
+//! Returns the first txid of a shard of the txid space. Coins are keyed by
+//! their serialized txid in the chainstate database, so the shards are split
+//! on its leading four bytes.
+Txid CoinsShardStart(uint32_t shard_index, uint32_t shard_count)
+{
+    uint256 start;
+    WriteBE32(start.begin(), static_cast<uint32_t>((uint64_t{shard_index} << 32) / shard_count));
+    return Txid::FromUint256(start);
+}
+
+//! Number of coins scanned between progress reports and interruption checks.
+constexpr uint64_t UTXO_STATS_PROGRESS_INTERVAL{100'000};
+
+//! Reports the number of coins scanned so far by all shards of a UTXO set scan.
+class UtxoStatsProgress
+{
+    const btck_UtxoStatsProgress m_callback;
+    void* const m_user_data;
+    Mutex m_mutex;
+    uint64_t m_coins_processed GUARDED_BY(m_mutex){0};
+
+public:
+    UtxoStatsProgress(btck_UtxoStatsProgress callback, void* user_data)
+        : m_callback{callback}, m_user_data{user_data} {}
+
+    void Add(uint64_t coins) EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        if (!m_callback || coins == 0) return;
+        LOCK(m_mutex);
+        m_coins_processed += coins;
+        m_callback(m_user_data, m_coins_processed);
+    }
+};
+
+//! Accumulates the statistics of the coins in [cursor, end) into stats, and
+//! their hash into muhash if it is non-null. The coins of a transaction are
+//! never split across shards, so the transaction counts of shards add up.
+bool ScanUtxoShard(CCoinsViewCursor& cursor, const std::optional<Txid>& end, MuHash3072* muhash, kernel::CCoinsStats& stats,
+                   const util::SignalInterrupt& interrupt, UtxoStatsProgress& progress)
+{
+    Txid prev_hash;
+    uint64_t unreported{0};
+    for (; cursor.Valid(); cursor.Next()) {
+        COutPoint key;
+        Coin coin;
+        if (!cursor.GetKey(key) || !cursor.GetValue(coin)) {
+            LogError("Failed to read coin from the chainstate database.");
+            return false;
+        }
+        if (end && key.hash >= *end) break;
+        if (stats.coins_count == 0 || key.hash != prev_hash) ++stats.nTransactions;
+        prev_hash = key.hash;
+        ++stats.coins_count;
+        ++stats.nTransactionOutputs;
+        if (stats.total_amount) stats.total_amount = CheckedAdd(*stats.total_amount, coin.out.nValue);
+        stats.nBogoSize += kernel::GetBogoSize(coin.out.scriptPubKey);
+        if (muhash) kernel::ApplyCoinHash(*muhash, key, coin);
+        if (++unreported == UTXO_STATS_PROGRESS_INTERVAL) {
+            if (interrupt) return false;
+            progress.Add(unreported);
+            unreported = 0;
+        }
+    }
+    progress.Add(unreported);
+    return true;
+}
+
+//! Thrown to abort hashing the UTXO set once the context is interrupted.
+struct UtxoStatsInterrupted {
+};
+
+//! Computes the statistics of the UTXO set of a chainstate, scanning
+//! shard_count shards of the chainstate database in parallel. The MuHash of
+//! the set is the product of the MuHashes of the shards, and is only computed
+//! if hash_type is MUHASH.
+std::optional<kernel::CCoinsStats> ComputeShardedUtxoStats(ChainstateManager& chainman, const std::shared_ptr<CoinsCursorRegistry>& registry,
+                                                           kernel::CoinStatsHashType hash_type, uint32_t shard_count, UtxoStatsProgress& progress)
+{
+    std::vector<std::unique_ptr<CCoinsViewCursor>> cursors;
+    const CBlockIndex* tip;
+    {
+        // The cursors iterate over snapshots of the database taken while
+        // holding cs_main, so all of them see the same UTXO set.
+        LOCK(chainman.GetMutex());
+        Chainstate& chainstate{chainman.ActiveChainstate()};
+        chainstate.ForceFlushStateToDisk(/*wipe_cache=*/false);
+        for (uint32_t i{0}; i < shard_count; ++i) {
+            cursors.push_back(std::make_unique<RegisteredCoinsViewCursor>(registry, OpenCoinsCursor(chainstate, registry, CoinsShardStart(i, shard_count))));
+        }
+        tip = chainman.m_blockman.LookupBlockIndex(cursors.front()->GetBestBlock());
+    }
+    if (!tip) {
+        LogError("Failed to compute UTXO set statistics: the best block of the chainstate is not indexed.");
+        return std::nullopt;
+    }
+
+    const bool with_muhash{hash_type == kernel::CoinStatsHashType::MUHASH};
+    std::vector<kernel::CCoinsStats> shard_stats(shard_count);
+    std::vector<MuHash3072> shard_muhashes(shard_count);
+    std::vector<char> shard_ok(shard_count, 0);
+    const auto scan_shard{[&](uint32_t i) {
+        std::optional<Txid> end;
+        if (i + 1 < shard_count) end = CoinsShardStart(i + 1, shard_count);
+        try {
+            shard_ok[i] = ScanUtxoShard(*cursors[i], end, with_muhash ? &shard_muhashes[i] : nullptr, shard_stats[i],
+                                        chainman.m_interrupt, progress);
+        } catch (const std::exception& e) {
+            LogError("Failed to scan UTXO set shard %u: %s", i, e.what());
+        }
+    }};
+    std::vector<std::thread> threads;
+    threads.reserve(shard_count - 1);
+    for (uint32_t i{1}; i < shard_count; ++i) {
+        threads.emplace_back([&scan_shard, i] {
+            util::ThreadRename(strprintf("utxostats.%i", i));
+            scan_shard(i);
+        });
+    }
+    scan_shard(0);
+    for (auto& thread : threads) thread.join();
+
+    kernel::CCoinsStats stats{tip->nHeight, tip->GetBlockHash()};
+    MuHash3072 muhash;
+    for (uint32_t i{0}; i < shard_count; ++i) {
+        if (!shard_ok[i]) {
+            if (chainman.m_interrupt) throw UtxoStatsInterrupted{};
+            return std::nullopt;
+        }
+        stats.nTransactions += shard_stats[i].nTransactions;
+        stats.nTransactionOutputs += shard_stats[i].nTransactionOutputs;
+        stats.coins_count += shard_stats[i].coins_count;
+        stats.nBogoSize += shard_stats[i].nBogoSize;
+        if (stats.total_amount && shard_stats[i].total_amount) {
+            stats.total_amount = CheckedAdd(*stats.total_amount, *shard_stats[i].total_amount);
+        } else {
+            stats.total_amount.reset();
+        }
+        if (with_muhash) muhash *= shard_muhashes[i];
+    }
+    if (with_muhash) muhash.Finalize(stats.hashSerialized);
+    return stats;
+}
+
+struct BlockColumns {
+    std::vector<uint32_t> tx_input_offsets;
+    std::vector<uint32_t> tx_output_offsets;
+    std::vector<unsigned char> txids;
+    std::vector<unsigned char> input_prevout_txids;
+    std::vector<uint32_t> input_prevout_indices;
+    std::vector<int64_t> output_amounts;
+    std::vector<uint32_t> output_script_offsets;
+    std::vector<unsigned char> output_scripts;
+    std::vector<int64_t> spent_amounts;
+    std::vector<uint32_t> spent_heights;
+    std::vector<uint8_t> spent_is_coinbase;
+    std::vector<uint32_t> spent_script_offsets;
+    std::vector<unsigned char> spent_scripts;
+
+    BlockColumns(const CBlock& block, const CBlockUndo* undo)
+    {
+        size_t num_inputs{0}, num_outputs{0}, outputs_script_size{0};
+        for (const auto& tx : block.vtx) {
+            num_inputs += tx->vin.size();
+            num_outputs += tx->vout.size();
+            for (const auto& output : tx->vout) outputs_script_size += output.scriptPubKey.size();
+        }
+        tx_input_offsets.reserve(block.vtx.size() + 1);
+        tx_output_offsets.reserve(block.vtx.size() + 1);
+        txids.reserve(block.vtx.size() * uint256::size());
+        input_prevout_txids.reserve(num_inputs * uint256::size());
+        input_prevout_indices.reserve(num_inputs);
+        output_amounts.reserve(num_outputs);
+        output_script_offsets.reserve(num_outputs + 1);
+        output_scripts.reserve(outputs_script_size);
+
+        for (const auto& tx : block.vtx) {
+            tx_input_offsets.push_back(input_prevout_indices.size());
+            tx_output_offsets.push_back(output_amounts.size());
+            const uint256& txid{tx->GetHash().ToUint256()};
+            txids.insert(txids.end(), txid.begin(), txid.end());
+            for (const auto& input : tx->vin) {
+                const uint256& prevout_txid{input.prevout.hash.ToUint256()};
+                input_prevout_txids.insert(input_prevout_txids.end(), prevout_txid.begin(), prevout_txid.end());
+                input_prevout_indices.push_back(input.prevout.n);
+            }
+            for (const auto& output : tx->vout) {
+                output_amounts.push_back(output.nValue);
+                output_script_offsets.push_back(output_scripts.size());
+                output_scripts.insert(output_scripts.end(), output.scriptPubKey.begin(), output.scriptPubKey.end());
+            }
+        }
+        tx_input_offsets.push_back(input_prevout_indices.size());
+        tx_output_offsets.push_back(output_amounts.size());
+        output_script_offsets.push_back(output_scripts.size());
+
+        if (!undo) return;
+        spent_amounts.reserve(num_inputs);
+        spent_heights.reserve(num_inputs);
+        spent_is_coinbase.reserve(num_inputs);
+        spent_script_offsets.reserve(num_inputs + 1);
+        for (size_t i = 0; i < block.vtx.size(); ++i) {
+            if (i == 0) {
+                // The coinbase input does not spend an output.
+                for (size_t j = 0; j < block.vtx[0]->vin.size(); ++j) {
+                    spent_amounts.push_back(0);
+                    spent_heights.push_back(0);
+                    spent_is_coinbase.push_back(0);
+                    spent_script_offsets.push_back(spent_scripts.size());
+                }
+                continue;
+            }
+            for (const Coin& coin : undo->vtxundo[i - 1].vprevout) {
+                spent_amounts.push_back(coin.out.nValue);
+                spent_heights.push_back(coin.nHeight);
+                spent_is_coinbase.push_back(coin.fCoinBase ? 1 : 0);
+                spent_script_offsets.push_back(spent_scripts.size());
+                spent_scripts.insert(spent_scripts.end(), coin.out.scriptPubKey.begin(), coin.out.scriptPubKey.end());
+            }
+        }
+        spent_script_offsets.push_back(spent_scripts.size());
+    }
+};
+
+//! Reads a block and, if undo is non-null, its undo data, looking up both
+//! positions on disk under a single lock. The genesis block has no undo data.
+bool ReadBlockAndUndo(const node::BlockManager& blockman, const CBlockIndex& index, CBlock& block, CBlockUndo* undo)
+{
+    const auto [block_pos, undo_pos]{WITH_LOCK(::cs_main, return std::pair(index.GetBlockPos(), index.GetUndoPos()))};
+    if (!blockman.ReadBlock(block, block_pos, index.GetBlockHash())) {
+        LogError("Failed to read block.");
+        return false;
+    }
+    if (undo && index.nHeight > 0 && !blockman.ReadBlockUndo(*undo, undo_pos, index.pprev->GetBlockHash())) {
+        LogError("Failed to read block spent outputs data.");
+        return false;
+    }
+    return true;
+}
+
+struct BlockAndUndo {
+    std::shared_ptr<CBlock> block;
+    //! Only set if the undo data was requested.
+    std::shared_ptr<CBlockUndo> undo;
+};
+
+//! Reads blocks on worker threads into a ring buffer of prefetch slots. Block i
+//! is only read once block i - prefetch has been taken out of its slot.
+class BlockRangeReader
+{
+    const std::shared_ptr<BlockRangeReaderRegistry> m_registry;
+    const node::BlockManager& m_blockman;
+    const std::vector<const CBlockIndex*> m_entries;
+    const bool m_with_undo;
+
+    Mutex m_mutex;
+    std::condition_variable m_worker_cv;
+    std::condition_variable m_reader_cv;
+    //! A read block, with a null block if reading it failed.
+    std::vector<std::optional<BlockAndUndo>> m_slots GUARDED_BY(m_mutex);
+    size_t m_next_read GUARDED_BY(m_mutex){0};
+    size_t m_next_out GUARDED_BY(m_mutex){0};
+    bool m_request_stop GUARDED_BY(m_mutex){false};
+    std::vector<std::thread> m_worker_threads;
+
+    void Loop() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        while (true) {
+            size_t index;
+            {
+                WAIT_LOCK(m_mutex, lock);
+                m_worker_cv.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) {
+                    return m_request_stop || m_next_read == m_entries.size() || m_next_read < m_next_out + m_slots.size();
+                });
+                if (m_request_stop || m_next_read == m_entries.size()) return;
+                index = m_next_read++;
+            }
+
+            BlockAndUndo result{std::make_shared<CBlock>(), m_with_undo ? std::make_shared<CBlockUndo>() : nullptr};
+            if (!ReadBlockAndUndo(m_blockman, *m_entries[index], *result.block, result.undo.get())) {
+                result = {};
+            }
+
+            LOCK(m_mutex);
+            m_slots[index % m_slots.size()] = std::move(result);
+            m_reader_cv.notify_one();
+        }
+    }
+
+public:
+    BlockRangeReader(std::shared_ptr<BlockRangeReaderRegistry> registry, const node::BlockManager& blockman, std::vector<const CBlockIndex*> entries, bool with_undo, size_t prefetch, int worker_threads)
+        : m_registry{std::move(registry)}, m_blockman{blockman}, m_entries{std::move(entries)}, m_with_undo{with_undo}, m_slots(prefetch)
+    {
+        m_worker_threads.reserve(worker_threads);
+        try {
+            for (int n = 0; n < worker_threads; ++n) {
+                m_worker_threads.emplace_back([this, n]() {
+                    util::ThreadRename(strprintf("blockread.%i", n));
+                    Loop();
+                });
+            }
+        } catch (...) {
+            Stop();
+            throw;
+        }
+        LOCK(m_registry->m_mutex);
+        m_registry->m_readers.insert(this);
+    }
+
+    BlockRangeReader(const BlockRangeReader&) = delete;
+    BlockRangeReader& operator=(const BlockRangeReader&) = delete;
+
+    //! Returns the next block, or a null block once all blocks were returned.
+    //! Returns nullopt if reading the next block failed, or the reader was
+    //! stopped.
+    std::optional<BlockAndUndo> Next() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        WAIT_LOCK(m_mutex, lock);
+        if (m_next_out == m_entries.size()) return BlockAndUndo{};
+        auto& slot{m_slots[m_next_out % m_slots.size()]};
+        m_reader_cv.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_request_stop || slot.has_value(); });
+        if (m_request_stop) return std::nullopt;
+        auto result{std::move(*slot)};
+        slot.reset();
+        ++m_next_out;
+        m_worker_cv.notify_one();
+        if (!result.block) return std::nullopt;
+        return result;
+    }
+
+    //! Stops and joins the worker threads. Blocks are no longer returned
+    //! afterwards. Must not be called concurrently with itself.
+    void Stop() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        WITH_LOCK(m_mutex, m_request_stop = true);
+        m_worker_cv.notify_all();
+        m_reader_cv.notify_all();
+        for (std::thread& thread : m_worker_threads) {
+            if (thread.joinable()) thread.join();
+        }
+    }
+
+    ~BlockRangeReader()
+    {
+        // Once unregistered, the chainstate manager no longer stops the
+        // reader, so the two calls to Stop() cannot overlap.
+        WITH_LOCK(m_registry->m_mutex, m_registry->m_readers.erase(this));
+        Stop();
+    }
+};
+
+//! A blocking queue with a maximum size, connecting two stages of the block
+//! import pipeline. It is drained once all of its producers are done.
+template <typename T>
+class ImportQueue
+{
+    const size_t m_capacity;
+    Mutex m_mutex;
+    std::condition_variable m_push_cv;
+    std::condition_variable m_pop_cv;
+    std::deque<T> m_items GUARDED_BY(m_mutex);
+    size_t m_producers GUARDED_BY(m_mutex);
+    bool m_stop GUARDED_BY(m_mutex){false};
+
+public:
+    ImportQueue(size_t capacity, size_t producers) : m_capacity{capacity}, m_producers{producers} {}
+
+    //! Returns false if the queue was stopped.
+    bool Push(T item) EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        WAIT_LOCK(m_mutex, lock);
+        m_push_cv.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_stop || m_items.size() < m_capacity; });
+        if (m_stop) return false;
+        m_items.push_back(std::move(item));
+        m_pop_cv.notify_one();
+        return true;
+    }
+
+    //! Returns nullopt once the queue is drained or was stopped.
+    std::optional<T> Pop() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        WAIT_LOCK(m_mutex, lock);
+        m_pop_cv.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_stop || !m_items.empty() || m_producers == 0; });
+        if (m_stop || m_items.empty()) return std::nullopt;
+        T item{std::move(m_items.front())};
+        m_items.pop_front();
+        m_push_cv.notify_one();
+        return item;
+    }
+
+    void ProducerDone() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        LOCK(m_mutex);
+        if (--m_producers == 0) m_pop_cv.notify_all();
+    }
+
+    void Stop() EXCLUSIVE_LOCKS_REQUIRED(!m_mutex)
+    {
+        LOCK(m_mutex);
+        m_stop = true;
+        m_push_cv.notify_all();
+        m_pop_cv.notify_all();
+    }
+};
+
+//! Reads up to dst.size() bytes into dst, returning the number of bytes read,
+//! or 0 at the end of the stream. Throws on read errors.
+using ReadBytesFn = std::function<size_t(std::span<std::byte>)>;
+
+//! Finds serialized blocks in a stream of block file data, the same way
+//! ChainstateManager::LoadExternalBlockFile does: each block is preceded by the
+//! network magic and its size, with arbitrary data possibly in between.
+class BlockStreamScanner
+{
+    static constexpr size_t READ_CHUNK_SIZE{1 << 20};
+    static constexpr size_t BLOCK_MARKER_SIZE{std::tuple_size_v<MessageStartChars> + sizeof(uint32_t)};
+
+    const ReadBytesFn m_read;
+    const MessageStartChars m_message_start;
+    std::vector<std::byte> m_buffer;
+    size_t m_pos{0};
+    //! Stream offset of the start of m_buffer.
+    uint64_t m_buffer_offset{0};
+    uint64_t m_block_offset{0};
+    bool m_eof{false};
+
+    //! Reads until at least size unread bytes are buffered. Returns false if
+    //! the stream ends before that.
+    bool Fill(size_t size)
+    {
+        if (m_pos > 0 && m_buffer.size() - m_pos < size) {
+            m_buffer.erase(m_buffer.begin(), m_buffer.begin() + m_pos);
+            m_buffer_offset += m_pos;
+            m_pos = 0;
+        }
+        while (m_buffer.size() - m_pos < size && !m_eof) {
+            const size_t buffered{m_buffer.size()};
+            m_buffer.resize(buffered + std::max(READ_CHUNK_SIZE, size - (buffered - m_pos)));
+            const size_t read{m_read(std::span{m_buffer}.subspan(buffered))};
+            m_buffer.resize(buffered + read);
+            m_eof = read == 0;
+        }
+        return m_buffer.size() - m_pos >= size;
+    }
+
+public:
+    BlockStreamScanner(ReadBytesFn read, const MessageStartChars& message_start)
+        : m_read{std::move(read)}, m_message_start{message_start} {}
+
+    //! Returns the next serialized block, or nullopt at the end of the stream.
+    std::optional<std::vector<std::byte>> Next()
+    {
+        while (Fill(BLOCK_MARKER_SIZE)) {
+            const auto marker{std::span{m_buffer}.subspan(m_pos)};
+            const auto found{std::find(marker.begin(), marker.end(), std::byte(m_message_start[0]))};
+            m_pos += found - marker.begin();
+            if (found == marker.end() || !Fill(BLOCK_MARKER_SIZE)) continue;
+            if (!std::equal(m_message_start.begin(), m_message_start.end(), UCharCast(m_buffer.data() + m_pos))) {
+                ++m_pos;
+                continue;
+            }
+            const uint32_t size{ReadLE32(m_buffer.data() + m_pos + m_message_start.size())};
+            if (size < 80 || size > MAX_BLOCK_SERIALIZED_SIZE) {
+                ++m_pos;
+                continue;
+            }
+            // A truncated block at the end of the stream is ignored.
+            if (!Fill(BLOCK_MARKER_SIZE + size)) return std::nullopt;
+            const auto begin{m_buffer.begin() + m_pos + BLOCK_MARKER_SIZE};
+            m_block_offset = m_buffer_offset + m_pos + BLOCK_MARKER_SIZE;
+            m_pos += BLOCK_MARKER_SIZE + size;
+            return std::vector<std::byte>(begin, begin + size);
+        }
+        return std::nullopt;
+    }
+
+    //! Returns the stream offset of the block last returned by Next.
+    uint64_t BlockOffset() const { return m_block_offset; }
+};
+
+//! A source of block file data for the import pipeline, opened on a reader
+//! thread. Opening returns an empty function if the source is unavailable.
+struct BlockSource {
+    std::string name;
+    std::function<ReadBytesFn()> open;
+    //! Path of a block file source, to re-read blocks from. Empty for streams.
+    fs::path path{};
+};
+
+//! A serialized block found in a block source.
+struct RawImportBlock {
+    std::vector<std::byte> data;
+    //! Index of the block source and offset of the block in it.
+    size_t source;
+    uint64_t offset;
+};
+
+//! A block that was deserialized and passed the context-free checks. Blocks
+//! of block files waiting for their parent drop the deserialized block and
+//! are re-read from the file later.
+struct CheckedImportBlock {
+    std::shared_ptr<const CBlock> block;
+    uint256 hash;
+    uint256 prev_hash;
+    //! Size of the serialized block.
+    size_t size;
+    size_t source;
+    uint64_t offset;
+};
+
+//! Number of block sources read at the same time. Blocks of later sources often
+//! wait for their parent in an earlier one, so this stays small.
+constexpr size_t MAX_IMPORT_READERS{2};
+//! Maximum serialized size of the blocks of streams held in memory until their
+//! parent is connected. Blocks whose parent is not found before it is reached
+//! are dropped, which fails the import.
+constexpr size_t MAX_UNKNOWN_PARENT_BYTES{256 << 20};
+//! Number of blocks buffered between two pipeline stages per parser thread.
+constexpr size_t IMPORT_QUEUE_BLOCKS_PER_PARSER{4};
+constexpr auto IMPORT_PROGRESS_INTERVAL{std::chrono::seconds{1}};
+
+//! Sets the block manager's importing flag for its lifetime, like ImportingNow
+//! in node/blockstorage.cpp, unless another import already set it.
+class ImportingBlocks
+{
+    std::atomic<bool>& m_importing;
+    const bool m_was_importing;
+
+public:
+    explicit ImportingBlocks(std::atomic<bool>& importing)
+        : m_importing{importing}, m_was_importing{importing.exchange(true)} {}
+    ~ImportingBlocks()
+    {
+        if (!m_was_importing) m_importing = false;
+    }
+};
+
+//! Imports blocks from block sources in three stages: reader threads scan the
+//! sources for serialized blocks, parser threads deserialize them and run the
+//! context-free CheckBlock, and the calling thread connects them in order
+//! through ProcessNewBlock, holding back blocks whose parent is not known yet.
+class BlockImportPipeline
+{
+    ChainstateManager& m_chainman;
+    const std::vector<BlockSource> m_sources;
+    const btck_ImportProgress m_progress;
+    void* const m_user_data;
+
+    std::atomic<size_t> m_next_source{0};
+    std::atomic<bool> m_read_failed{false};
+    ImportQueue<RawImportBlock> m_raw_blocks;
+    ImportQueue<CheckedImportBlock> m_checked_blocks;
+    std::vector<std::thread> m_threads;
+
+    uint64_t m_blocks_imported{0};
+    uint64_t m_bytes_imported{0};
+    SteadyClock::time_point m_start;
+    SteadyClock::time_point m_last_report;
+
+    void ReadLoop()
+    {
+        for (size_t i{m_next_source++}; i < m_sources.size(); i = m_next_source++) {
+            try {
+                auto read{m_sources[i].open()};
+                if (!read) {
+                    LogWarning("Failed to open %s for import.", m_sources[i].name);
+                    continue;
+                }
+                BlockStreamScanner scanner{std::move(read), m_chainman.GetParams().MessageStart()};
+                while (auto raw_block{scanner.Next()}) {
+                    if (m_chainman.m_interrupt || !m_raw_blocks.Push({std::move(*raw_block), i, scanner.BlockOffset()})) break;
+                }
+            } catch (const std::exception& e) {
+                LogError("Failed to read %s for import: %s", m_sources[i].name, e.what());
+                m_read_failed = true;
+            }
+        }
+        m_raw_blocks.ProducerDone();
+    }
+
+    void CheckLoop()
+    {
+        while (auto raw_block{m_raw_blocks.Pop()}) {
+            auto block{std::make_shared<CBlock>()};
+            try {
+                SpanReader{raw_block->data} >> TX_WITH_WITNESS(*block);
+            } catch (const std::exception& e) {
+                LogDebug(BCLog::KERNEL, "Skipping undecodable block during import: %s", e.what());
+                continue;
+            }
+            // Marks the block as checked, so ProcessNewBlock does not repeat this.
+            BlockValidationState state;
+            if (!CheckBlock(*block, state, m_chainman.GetConsensus())) {
+                LogDebug(BCLog::KERNEL, "Skipping block %s during import: %s", block->GetHash().ToString(), state.ToString());
+                continue;
+            }
+            const uint256 hash{block->GetHash()};
+            const uint256 prev_hash{block->hashPrevBlock};
+            if (!m_checked_blocks.Push({std::move(block), hash, prev_hash, raw_block->data.size(), raw_block->source, raw_block->offset})) break;
+        }
+        m_checked_blocks.ProducerDone();
+    }
+
+    //! Returns whether the block's parent is in the block index, so it can be
+    //! connected.
+    bool HasParent(const CheckedImportBlock& checked) const
+    {
+        if (checked.hash == m_chainman.GetConsensus().hashGenesisBlock) return true;
+        LOCK(::cs_main);
+        return m_chainman.m_blockman.LookupBlockIndex(checked.prev_hash) != nullptr;
+    }
+
+    //! Reads a block that waited for its parent back from its block file.
+    //! Returns null and fails the import if that is not possible.
+    std::shared_ptr<const CBlock> ReadHeldBlock(const CheckedImportBlock& held)
+    {
+        const BlockSource& source{m_sources[held.source]};
+        try {
+            AutoFile file{fsbridge::fopen(source.path, "rb")};
+            if (file.IsNull()) throw std::runtime_error{"failed to open the file"};
+            file.seek(held.offset, SEEK_SET);
+            auto block{std::make_shared<CBlock>()};
+            file >> TX_WITH_WITNESS(*block);
+            if (block->GetHash() != held.hash) throw std::runtime_error{"the block changed"};
+            return block;
+        } catch (const std::exception& e) {
+            LogError("Failed to re-read block %s from %s for import: %s", held.hash.ToString(), source.name, e.what());
+            m_read_failed = true;
+            return nullptr;
+        }
+    }
+
+    void Connect(const CheckedImportBlock& checked)
+    {
+        const bool have_data{WITH_LOCK(::cs_main, {
+            const CBlockIndex* index{m_chainman.m_blockman.LookupBlockIndex(checked.hash)};
+            return index && (index->nStatus & BLOCK_HAVE_DATA);
+        })};
+        if (!have_data && m_chainman.ProcessNewBlock(checked.block, /*force_processing=*/true, /*min_pow_checked=*/true, /*new_block=*/nullptr)) {
+            ++m_blocks_imported;
+            m_bytes_imported += checked.size;
+        }
+        const auto now{SteadyClock::now()};
+        if (now - m_last_report >= IMPORT_PROGRESS_INTERVAL) {
+            m_last_report = now;
+            ReportProgress();
+        }
+    }
+
+    void ReportProgress() const
+    {
+        if (!m_progress) return;
+        const double seconds{std::max(Ticks<SecondsDouble>(SteadyClock::now() - m_start), 1e-9)};
+        m_progress(m_user_data, m_blocks_imported, m_bytes_imported, m_blocks_imported / seconds, m_bytes_imported / seconds);
+    }
+
+    //! Stops the pipeline and joins its threads.
+    void Stop()
+    {
+        m_raw_blocks.Stop();
+        m_checked_blocks.Stop();
+        for (std::thread& thread : m_threads) {
+            if (thread.joinable()) thread.join();
+        }
+    }
+
+public:
+    BlockImportPipeline(ChainstateManager& chainman, std::vector<BlockSource> sources, int parser_threads, btck_ImportProgress progress, void* user_data)
+        : m_chainman{chainman},
+          m_sources{std::move(sources)},
+          m_progress{progress},
+          m_user_data{user_data},
+          m_raw_blocks{parser_threads * IMPORT_QUEUE_BLOCKS_PER_PARSER, std::min(m_sources.size(), MAX_IMPORT_READERS)},
+          m_checked_blocks{parser_threads * IMPORT_QUEUE_BLOCKS_PER_PARSER, static_cast<size_t>(parser_threads)}
+    {
+        const size_t readers{std::min(m_sources.size(), MAX_IMPORT_READERS)};
+        m_threads.reserve(readers + parser_threads);
+        try {
+            for (size_t n = 0; n < readers; ++n) {
+                m_threads.emplace_back([this, n]() {
+                    util::ThreadRename(strprintf("importread.%i", n));
+                    ReadLoop();
+                });
+            }
+            for (int n = 0; n < parser_threads; ++n) {
+                m_threads.emplace_back([this, n]() {
+                    util::ThreadRename(strprintf("importcheck.%i", n));
+                    CheckLoop();
+                });
+            }
+        } catch (...) {
+            // The destructor does not run if the constructor throws.
+            Stop();
+            throw;
+        }
+    }
+
+    BlockImportPipeline(const BlockImportPipeline&) = delete;
+    BlockImportPipeline& operator=(const BlockImportPipeline&) = delete;
+
+    //! Connects the checked blocks on the calling thread until all sources
+    //! were read. Blocks of block files whose parent is not known yet are
+    //! re-read once it is, those of streams are held in memory. Blocks whose
+    //! parent is never found, or blocks of streams found once
+    //! MAX_UNKNOWN_PARENT_BYTES of such blocks are held back, are dropped.
+    //! Returns false if reading a source failed, or if blocks were dropped
+    //! because too many were held back, since their descendants could not be
+    //! connected either.
+    bool Run()
+    {
+        ImportingBlocks importing{m_chainman.m_blockman.m_importing};
+        m_start = m_last_report = SteadyClock::now();
+        std::multimap<uint256, CheckedImportBlock> unknown_parent;
+        size_t unknown_parent_bytes{0};
+        uint64_t dropped{0};
+        while (auto checked{m_checked_blocks.Pop()}) {
+            if (m_chainman.m_interrupt) break;
+            if (!HasParent(*checked)) {
+                if (!m_sources[checked->source].path.empty()) {
+                    checked->block.reset();
+                } else if (unknown_parent_bytes + checked->size > MAX_UNKNOWN_PARENT_BYTES) {
+                    ++dropped;
+                    continue;
+                } else {
+                    unknown_parent_bytes += checked->size;
+                }
+                unknown_parent.emplace(checked->prev_hash, std::move(*checked));
+                continue;
+            }
+            Connect(*checked);
+            // Connect the earlier encountered descendants of this block.
+            std::deque<uint256> queue{checked->hash};
+            while (!queue.empty()) {
+                auto range{unknown_parent.equal_range(queue.front())};
+                queue.pop_front();
+                for (auto it{range.first}; it != range.second; it = unknown_parent.erase(it)) {
+                    CheckedImportBlock& held{it->second};
+                    if (held.block) {
+                        unknown_parent_bytes -= held.size;
+                    } else if (!(held.block = ReadHeldBlock(held))) {
+                        continue;
+                    }
+                    Connect(held);
+                    queue.push_back(held.hash);
+                }
+            }
+        }
+        if (dropped > 0) {
+            LogError("Dropped %u imported blocks, because more than %u MiB of blocks were waiting for their parent.", dropped, MAX_UNKNOWN_PARENT_BYTES >> 20);
+        }
+        if (!unknown_parent.empty()) {
+            LogDebug(BCLog::KERNEL, "Dropped %u imported blocks with an unknown parent.", unknown_parent.size());
+        }
+        ReportProgress();
+        return !m_read_failed && dropped == 0;
+    }
+
+    ~BlockImportPipeline()
+    {
+        Stop();
+    }
+};
+
+int ImportBlockSources(ChainstateManager& chainman, std::vector<BlockSource> sources, int threads, btck_ImportProgress progress, void* user_data)
+{
+    try {
+        const bool read_ok{BlockImportPipeline{chainman, std::move(sources), threads, progress, user_data}.Run()};
+        WITH_LOCK(::cs_main, chainman.UpdateIBDStatus());
+        if (chainman.m_interrupt) {
+            LogError("Block import was interrupted.");
+            return -1;
+        }
+        return read_ok ? 0 : -1;
+    } catch (const std::exception& e) {
+        LogError("Failed to import blocks: %s", e.what());
+        return -1;
+    }
+}
+
+} // namespace
+
+struct btck_Transaction : Handle<btck_Transaction, std::shared_ptr<const CTransaction>> {};
+struct btck_TransactionOutput : Handle<btck_TransactionOutput, CTxOut> {};
+struct btck_ScriptPubkey : Handle<btck_ScriptPubkey, CScript> {};
+struct btck_LoggingConnection : Handle<btck_LoggingConnection, LoggingConnection> {};
+struct btck_ContextOptions : Handle<btck_ContextOptions, ContextOptions> {};
+struct btck_Context : Handle<btck_Context, std::shared_ptr<const Context>> {};
+struct btck_ChainParameters : Handle<btck_ChainParameters, CChainParams> {};
+struct btck_ChainstateManagerOptions : Handle<btck_ChainstateManagerOptions, ChainstateManagerOptions> {};
+struct btck_ChainstateManager : Handle<btck_ChainstateManager, ChainMan> {};
+struct btck_Chain : Handle<btck_Chain, CChain> {};
+struct btck_ChainSnapshot : Handle<btck_ChainSnapshot, std::vector<const CBlockIndex*>> {};
+struct btck_BlockSpentOutputs : Handle<btck_BlockSpentOutputs, std::shared_ptr<CBlockUndo>> {};
+struct btck_TransactionSpentOutputs : Handle<btck_TransactionSpentOutputs, CTxUndo> {};
+struct btck_Coin : Handle<btck_Coin, Coin> {};
+struct btck_BlockHash : Handle<btck_BlockHash, uint256> {};
+struct btck_TransactionInput : Handle<btck_TransactionInput, CTxIn> {};
+struct btck_TransactionOutPoint: Handle<btck_TransactionOutPoint, COutPoint> {};
+struct btck_Txid: Handle<btck_Txid, Txid> {};
+struct btck_PrecomputedTransactionData : Handle<btck_PrecomputedTransactionData, PrecomputedTransactionData> {};
+struct btck_BlockHeader: Handle<btck_BlockHeader, CBlockHeader> {};
+struct btck_ConsensusParams: Handle<btck_ConsensusParams, Consensus::Params> {};
+struct btck_CoinsCursor : Handle<btck_CoinsCursor, CoinsCursor> {};
+struct btck_UtxoStats : Handle<btck_UtxoStats, kernel::CCoinsStats> {};
+struct btck_ScriptCheckQueue : Handle<btck_ScriptCheckQueue, CCheckQueue<InputCheck>> {};
+struct btck_SignatureCache : Handle<btck_SignatureCache, ScriptCaches> {};
+struct btck_BlockRangeReader : Handle<btck_BlockRangeReader, BlockRangeReader> {};
+struct btck_BlockColumns : Handle<btck_BlockColumns, BlockColumns> {};
+struct btck_MempoolOptions : Handle<btck_MempoolOptions, kernel::MemPoolOptions> {};
+//! Accepting transactions needs the active chainstate, so the mempool handle
+//! refers to the chainstate manager hosting it.
+struct btck_Mempool : Handle<btck_Mempool, ChainMan> {};
+
+btck_Transaction* btck_transaction_create(const void* raw_transaction, size_t raw_transaction_len)
+{
+    if (raw_transaction == nullptr && raw_transaction_len != 0) {
+        return nullptr;
+    }
+    try {
+        SpanReader stream{std::span{reinterpret_cast<const std::byte*>(raw_transaction), raw_transaction_len}};
+        return btck_Transaction::create(std::make_shared<const CTransaction>(deserialize, TX_WITH_WITNESS, stream));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+size_t btck_transaction_count_outputs(const btck_Transaction* transaction)
+{
+    return btck_Transaction::get(transaction)->vout.size();
+}
+
+const btck_TransactionOutput* btck_transaction_get_output_at(const btck_Transaction* transaction, size_t output_index)
+{
+    const CTransaction& tx = *btck_Transaction::get(transaction);
+    assert(output_index < tx.vout.size());
+    return btck_TransactionOutput::ref(&tx.vout[output_index]);
+}
+
+size_t btck_transaction_count_inputs(const btck_Transaction* transaction)
+{
+    return btck_Transaction::get(transaction)->vin.size();
+}
+
+const btck_TransactionInput* btck_transaction_get_input_at(const btck_Transaction* transaction, size_t input_index)
+{
+    assert(input_index < btck_Transaction::get(transaction)->vin.size());
+    return btck_TransactionInput::ref(&btck_Transaction::get(transaction)->vin[input_index]);
+}
+
+uint32_t btck_transaction_get_locktime(const btck_Transaction* transaction)
+{
+    return btck_Transaction::get(transaction)->nLockTime;
+}
+
+const btck_Txid* btck_transaction_get_txid(const btck_Transaction* transaction)
+{
+    return btck_Txid::ref(&btck_Transaction::get(transaction)->GetHash());
+}
+
+btck_Transaction* btck_transaction_copy(const btck_Transaction* transaction)
+{
+    return btck_Transaction::copy(transaction);
+}
+
+int btck_transaction_to_bytes(const btck_Transaction* transaction, btck_WriteBytes writer, void* user_data)
+{
+    try {
+        WriterStream ws{writer, user_data};
+        ws << TX_WITH_WITNESS(btck_Transaction::get(transaction));
+        return 0;
+    } catch (...) {
+        return -1;
+    }
+}
+
+size_t btck_transaction_serialized_size(const btck_Transaction* transaction)
+{
+    return GetSerializeSize(TX_WITH_WITNESS(*btck_Transaction::get(transaction)));
+}
+
+int btck_transaction_to_buffer(const btck_Transaction* transaction, void* buffer, size_t buffer_len)
+{
+    try {
+        SpanWriter{std::span{reinterpret_cast<std::byte*>(buffer), buffer_len}} << TX_WITH_WITNESS(*btck_Transaction::get(transaction));
+        return 0;
+    } catch (const std::exception& e) {
+        LogError("Failed to serialize transaction into a buffer of %u bytes: %s", buffer_len, e.what());
         return -1;
     }
 }
@@ -655,6 +2194,81 @@ void btck_precomputed_transaction_data_destroy(btck_PrecomputedTransactionData*
     delete precomputed_txdata;
 }
 
+btck_ScriptCheckQueue* btck_script_check_queue_create(int worker_threads)
+{
+    try {
+        return btck_ScriptCheckQueue::create(/*batch_size=*/128, std::clamp(worker_threads, 0, MAX_SCRIPTCHECK_THREADS));
+    } catch (const std::exception& e) {
+        LogError("Failed to create script check queue: %s", e.what());
+        return nullptr;
+    }
+}
+
+void btck_script_check_queue_destroy(btck_ScriptCheckQueue* script_check_queue)
+{
+    delete script_check_queue;
+}
+
+btck_SignatureCache* btck_signature_cache_create(size_t signature_cache_bytes, size_t script_execution_cache_bytes)
+{
+    try {
+        return btck_SignatureCache::create(signature_cache_bytes, script_execution_cache_bytes);
+    } catch (const std::exception& e) {
+        LogError("Failed to create signature cache: %s", e.what());
+        return nullptr;
+    }
+}
+
+uint64_t btck_signature_cache_get_hits(const btck_SignatureCache* signature_cache)
+{
+    return btck_SignatureCache::get(signature_cache).m_hits.load();
+}
+
+void btck_signature_cache_destroy(btck_SignatureCache* signature_cache)
+{
+    delete signature_cache;
+}
+
+namespace {
+int ScriptPubkeyVerify(const btck_ScriptPubkey* script_pubkey,
+                       const int64_t amount,
+                       const btck_Transaction* tx_to,
+                       const btck_PrecomputedTransactionData* precomputed_txdata,
+                       const unsigned int input_index,
+                       const btck_ScriptVerificationFlags flags,
+                       btck_SignatureCache* signature_cache,
+                       btck_ScriptVerifyStatus* status)
+{
+    // Assert that all specified flags are part of the interface before continuing
+    assert((flags & ~btck_ScriptVerificationFlags_ALL) == 0);
+
+    if (!is_valid_flag_combination(script_verify_flags::from_int(flags))) {
+        if (status) *status = btck_ScriptVerifyStatus_ERROR_INVALID_FLAGS_COMBINATION;
+        return 0;
+    }
+
+    const CTransaction& tx{*btck_Transaction::get(tx_to)};
+    assert(input_index < tx.vin.size());
+
+    // Only built if the caller did not precompute the transaction data.
+    std::optional<PrecomputedTransactionData> default_txdata;
+    if (!precomputed_txdata) default_txdata.emplace(tx);
+    const PrecomputedTransactionData& txdata{precomputed_txdata ? btck_PrecomputedTransactionData::get(precomputed_txdata) : *default_txdata};
+
+    if (flags & btck_ScriptVerificationFlags_TAPROOT && txdata.m_spent_outputs.empty()) {
+        if (status) *status = btck_ScriptVerifyStatus_ERROR_SPENT_OUTPUTS_REQUIRED;
+        return 0;
+    }
+
+    if (status) *status = btck_ScriptVerifyStatus_OK;
+
+    bool result = VerifyInput(tx, input_index, btck_ScriptPubkey::get(script_pubkey), amount, txdata,
+                              script_verify_flags::from_int(flags),
+                              signature_cache ? &btck_SignatureCache::get(signature_cache) : nullptr);
+    return result ? 1 : 0;
+}
+} // namespace
+
 int btck_script_pubkey_verify(const btck_ScriptPubkey* script_pubkey,
                               const int64_t amount,
                               const btck_Transaction* tx_to,
@@ -662,6 +2276,29 @@ int btck_script_pubkey_verify(const btck_ScriptPubkey* script_pubkey,
                               const unsigned int input_index,
                               const btck_ScriptVerificationFlags flags,
                               btck_ScriptVerifyStatus* status)
+{
+    return ScriptPubkeyVerify(script_pubkey, amount, tx_to, precomputed_txdata, input_index, flags, /*signature_cache=*/nullptr, status);
+}
+
+int btck_script_pubkey_verify_cached(const btck_ScriptPubkey* script_pubkey,
+                                     const int64_t amount,
+                                     const btck_Transaction* tx_to,
+                                     const btck_PrecomputedTransactionData* precomputed_txdata,
+                                     const unsigned int input_index,
+                                     const btck_ScriptVerificationFlags flags,
+                                     btck_SignatureCache* signature_cache,
+                                     btck_ScriptVerifyStatus* status)
+{
+    return ScriptPubkeyVerify(script_pubkey, amount, tx_to, precomputed_txdata, input_index, flags, signature_cache, status);
+}
+
+int btck_transaction_verify_inputs(const btck_Transaction* tx_to,
+                                   const btck_TransactionOutput** spent_outputs_, size_t spent_outputs_len,
+                                   const btck_ScriptVerificationFlags flags,
+                                   btck_ScriptCheckQueue* script_check_queue,
+                                   btck_SignatureCache* signature_cache,
+                                   int* results_,
+                                   btck_ScriptVerifyStatus* status)
 {
     // Assert that all specified flags are part of the interface before continuing
     assert((flags & ~btck_ScriptVerificationFlags_ALL) == 0);
@@ -672,24 +2309,64 @@ int btck_script_pubkey_verify(const btck_ScriptPubkey* script_pubkey,
     }
 
     const CTransaction& tx{*btck_Transaction::get(tx_to)};
-    assert(input_index < tx.vin.size());
-
-    const PrecomputedTransactionData& txdata{precomputed_txdata ? btck_PrecomputedTransactionData::get(precomputed_txdata) : PrecomputedTransactionData(tx)};
-
-    if (flags & btck_ScriptVerificationFlags_TAPROOT && txdata.m_spent_outputs.empty()) {
-        if (status) *status = btck_ScriptVerifyStatus_ERROR_SPENT_OUTPUTS_REQUIRED;
+    if (spent_outputs_len != tx.vin.size()) {
+        if (status) *status = btck_ScriptVerifyStatus_ERROR_SPENT_OUTPUTS_MISMATCH;
         return 0;
     }
 
     if (status) *status = btck_ScriptVerifyStatus_OK;
 
-    bool result = VerifyScript(tx.vin[input_index].scriptSig,
-                               btck_ScriptPubkey::get(script_pubkey),
-                               &tx.vin[input_index].scriptWitness,
-                               script_verify_flags::from_int(flags),
-                               TransactionSignatureChecker(&tx, input_index, amount, txdata, MissingDataBehavior::FAIL),
-                               nullptr);
-    return result ? 1 : 0;
+    std::vector<CTxOut> spent_outputs;
+    spent_outputs.reserve(spent_outputs_len);
+    for (size_t i = 0; i < spent_outputs_len; i++) {
+        spent_outputs.push_back(btck_TransactionOutput::get(spent_outputs_[i]));
+    }
+    ScriptCaches* caches{signature_cache ? &btck_SignatureCache::get(signature_cache) : nullptr};
+
+    // Unlike in block validation, the spent outputs are not committed to by
+    // the caller, so they are part of the script execution cache entry.
+    uint256 cache_entry;
+    if (caches) {
+        const uint256 spent_outputs_hash{(HashWriter{} << spent_outputs).GetSHA256()};
+        caches->m_cache.ScriptExecutionCacheHasher()
+            .Write(UCharCast(tx.GetWitnessHash().begin()), 32)
+            .Write(reinterpret_cast<const unsigned char*>(&flags), sizeof(flags))
+            .Write(spent_outputs_hash.begin(), 32)
+            .Finalize(cache_entry.begin());
+        LOCK(caches->m_mutex);
+        if (caches->m_cache.m_script_execution_cache.contains(cache_entry, /*erase=*/false)) {
+            ++caches->m_hits;
+            if (results_) std::fill_n(results_, tx.vin.size(), 1);
+            return 1;
+        }
+    }
+
+    PrecomputedTransactionData txdata;
+    txdata.Init(tx, std::move(spent_outputs));
+
+    std::vector<int> results(tx.vin.size(), 0);
+    std::vector<InputCheck> checks;
+    checks.reserve(tx.vin.size());
+    for (unsigned int i = 0; i < tx.vin.size(); i++) {
+        checks.emplace_back(tx, txdata, i, script_verify_flags::from_int(flags), caches, results[i]);
+    }
+    if (script_check_queue) {
+        CCheckQueueControl<InputCheck> control{btck_ScriptCheckQueue::get(script_check_queue)};
+        control.Add(std::move(checks));
+        (void)control.Complete();
+    } else {
+        for (const auto& check : checks) {
+            (void)check();
+        }
+    }
+
+    if (results_) std::copy(results.begin(), results.end(), results_);
+    const bool all_valid{std::ranges::all_of(results, [](int result) { return result == 1; })};
+    if (caches && all_valid) {
+        LOCK(caches->m_mutex);
+        caches->m_cache.m_script_execution_cache.insert(cache_entry);
+    }
+    return all_valid ? 1 : 0;
 }
 
 btck_TransactionInput* btck_transaction_input_copy(const btck_TransactionInput* input)
@@ -712,6 +2389,11 @@ void btck_transaction_input_destroy(btck_TransactionInput* input)
     delete input;
 }
 
+btck_TransactionOutPoint* btck_transaction_out_point_create(const btck_Txid* txid, uint32_t index)
+{
+    return btck_TransactionOutPoint::create(btck_Txid::get(txid), index);
+}
+
 btck_TransactionOutPoint* btck_transaction_out_point_copy(const btck_TransactionOutPoint* out_point)
 {
     return btck_TransactionOutPoint::copy(out_point);
@@ -732,6 +2414,11 @@ void btck_transaction_out_point_destroy(btck_TransactionOutPoint* out_point)
     delete out_point;
 }
 
+btck_Txid* btck_txid_create(const unsigned char txid[32])
+{
+    return btck_Txid::create(Txid::FromUint256(uint256{std::span<const unsigned char>{txid, 32}}));
+}
+
 btck_Txid* btck_txid_copy(const btck_Txid* txid)
 {
     return btck_Txid::copy(txid);
@@ -828,6 +2515,24 @@ btck_ChainParameters* btck_chain_parameters_copy(const btck_ChainParameters* cha
     return btck_ChainParameters::copy(chain_parameters);
 }
 
+int btck_chain_parameters_add_assumeutxo(btck_ChainParameters* chain_parameters, int32_t height, const btck_BlockHash* block_hash,
+                                         const unsigned char hash_serialized[32], uint64_t chain_tx_count)
+{
+    auto& params{btck_ChainParameters::get(chain_parameters)};
+    const uint256& base_blockhash{btck_BlockHash::get(block_hash)};
+    if (height < 1 || params.AssumeutxoForHeight(height) || params.AssumeutxoForBlockhash(base_blockhash)) {
+        LogError("Invalid or duplicate assumeutxo snapshot at height %d.", height);
+        return -1;
+    }
+    params.AddAssumeutxoData({
+        .height = height,
+        .hash_serialized = AssumeutxoHash{uint256{std::span<const unsigned char>{hash_serialized, 32}}},
+        .m_chain_tx_count = chain_tx_count,
+        .blockhash = base_blockhash,
+    });
+    return 0;
+}
+
 const btck_ConsensusParams* btck_chain_parameters_get_consensus_params(const btck_ChainParameters* chain_parameters)
 {
     return btck_ConsensusParams::ref(&btck_ChainParameters::get(chain_parameters).GetConsensus());
@@ -863,6 +2568,37 @@ void btck_context_options_set_validation_interface(btck_ContextOptions* options,
     btck_ContextOptions::get(options).m_validation_interface = std::make_shared<KernelValidationInterface>(vi_cbs);
 }
 
+int btck_context_options_set_validation_interface_queue(btck_ContextOptions* options, size_t capacity, btck_ValidationQueueOverflow overflow)
+{
+    if (capacity == 0) {
+        LogError("Validation interface queue capacity must be at least 1.");
+        return -1;
+    }
+    if (overflow != btck_ValidationQueueOverflow_BLOCK && overflow != btck_ValidationQueueOverflow_DROP_OLDEST) {
+        LogError("Invalid validation interface queue overflow policy %i.", overflow);
+        return -1;
+    }
+    LOCK(btck_ContextOptions::get(options).m_mutex);
+    btck_ContextOptions::get(options).m_validation_queue = ValidationQueueOptions{capacity, overflow};
+    return 0;
+}
+
+int btck_context_options_set_tip_notification_limit(btck_ContextOptions* options, int64_t min_interval_ms, int64_t min_blocks)
+{
+    if (min_interval_ms < 0 || min_blocks < 0) {
+        LogError("Tip notification limits must not be negative, got %d ms and %d blocks.", min_interval_ms, min_blocks);
+        return -1;
+    }
+    LOCK(btck_ContextOptions::get(options).m_mutex);
+    auto& limit{btck_ContextOptions::get(options).m_tip_notification_limit};
+    if (min_interval_ms == 0 && min_blocks == 0) {
+        limit.reset();
+    } else {
+        limit = TipNotificationLimit{std::chrono::milliseconds{min_interval_ms}, min_blocks};
+    }
+    return 0;
+}
+
 void btck_context_options_destroy(btck_ContextOptions* options)
 {
     delete options;
@@ -895,6 +2631,13 @@ void btck_context_destroy(btck_Context* context)
     delete context;
 }
 
+void btck_context_sync_validation_interface_queue(const btck_Context* context)
+{
+    if (const auto& signals{btck_Context::get(context)->m_signals}) {
+        signals->FlushBackgroundCallbacks();
+    }
+}
+
 const btck_BlockTreeEntry* btck_block_tree_entry_get_previous(const btck_BlockTreeEntry* entry)
 {
     if (!btck_BlockTreeEntry::get(entry).pprev) {
@@ -912,6 +2655,18 @@ const btck_BlockTreeEntry* btck_block_tree_entry_get_ancestor(const btck_BlockTr
     return btck_BlockTreeEntry::ref(ancestor);
 }
 
+int btck_block_tree_entry_has_data(const btck_BlockTreeEntry* entry)
+{
+    LOCK(::cs_main);
+    return btck_BlockTreeEntry::get(entry).nStatus & BLOCK_HAVE_DATA ? 1 : 0;
+}
+
+int btck_block_tree_entry_has_undo(const btck_BlockTreeEntry* entry)
+{
+    LOCK(::cs_main);
+    return btck_BlockTreeEntry::get(entry).nStatus & BLOCK_HAVE_UNDO ? 1 : 0;
+}
+
 btck_BlockValidationState* btck_block_validation_state_create()
 {
     return btck_BlockValidationState::create();
@@ -961,28 +2716,188 @@ btck_BlockValidationResult btck_block_validation_state_get_block_validation_resu
     assert(false);
 }
 
-btck_ChainstateManagerOptions* btck_chainstate_manager_options_create(const btck_Context* context, const char* data_dir, size_t data_dir_len, const char* blocks_dir, size_t blocks_dir_len)
+btck_MempoolOptions* btck_mempool_options_create()
+{
+    return btck_MempoolOptions::create();
+}
+
+int btck_mempool_options_set_max_size(btck_MempoolOptions* mempool_options, int64_t max_size_bytes)
+{
+    if (max_size_bytes < 0) {
+        LogError("Mempool size must not be negative, got %d bytes.", max_size_bytes);
+        return -1;
+    }
+    btck_MempoolOptions::get(mempool_options).max_size_bytes = max_size_bytes;
+    return 0;
+}
+
+int btck_mempool_options_set_expiry(btck_MempoolOptions* mempool_options, int64_t expiry_seconds)
+{
+    if (expiry_seconds < 0) {
+        LogError("Mempool expiry must not be negative, got %d seconds.", expiry_seconds);
+        return -1;
+    }
+    btck_MempoolOptions::get(mempool_options).expiry = std::chrono::seconds{expiry_seconds};
+    return 0;
+}
+
+int btck_mempool_options_set_limits(btck_MempoolOptions* mempool_options, uint32_t cluster_count, int64_t cluster_size_vbytes, int64_t ancestor_count, int64_t descendant_count)
+{
+    if (cluster_count == 0 || cluster_size_vbytes <= 0 || ancestor_count <= 0 || descendant_count <= 0) {
+        LogError("Mempool limits must be positive.");
+        return -1;
+    }
+    btck_MempoolOptions::get(mempool_options).limits = kernel::MemPoolLimits{
+        .cluster_count = cluster_count,
+        .cluster_size_vbytes = cluster_size_vbytes,
+        .ancestor_count = ancestor_count,
+        .descendant_count = descendant_count,
+    };
+    return 0;
+}
+
+void btck_mempool_options_set_require_standard(btck_MempoolOptions* mempool_options, int require_standard)
+{
+    btck_MempoolOptions::get(mempool_options).require_standard = require_standard == 1;
+}
+
+void btck_mempool_options_destroy(btck_MempoolOptions* mempool_options)
+{
+    delete mempool_options;
+}
+
+btck_MempoolAcceptResult btck_mempool_accept_transaction(btck_Mempool* mempool, const btck_Transaction* transaction, int test_accept, btck_WriteBytes reject_reason, void* user_data)
+{
+    auto& chainman{*btck_Mempool::get(mempool).m_chainman};
+    const auto result{WITH_LOCK(chainman.GetMutex(), return chainman.ProcessTransaction(btck_Transaction::get(transaction), test_accept == 1))};
+    WriteRejectReason(result.m_state, reject_reason, user_data);
+    return cast_mempool_accept_result(result.m_result_type);
+}
+
+int btck_mempool_accept_package(btck_Mempool* mempool, const btck_Transaction** transactions, size_t len, int test_accept, btck_MempoolAcceptResult* results, btck_WriteBytes reject_reason, void* user_data)
+{
+    if (len == 0) {
+        LogError("Failed to accept package: it must not be empty");
+        return -1;
+    }
+    auto& chainman{*btck_Mempool::get(mempool).m_chainman};
+    Package package;
+    package.reserve(len);
+    for (size_t i{0}; i < len; ++i) {
+        if (transactions[i] == nullptr) {
+            LogError("Failed to accept package: transaction %u is null", i);
+            return -1;
+        }
+        package.push_back(btck_Transaction::get(transactions[i]));
+    }
+    const auto package_result{WITH_LOCK(chainman.GetMutex(), return ProcessNewPackage(chainman.ActiveChainstate(), *btck_Mempool::get(mempool).m_mempool, package, test_accept == 1, /*client_maxfeerate=*/std::nullopt))};
+    for (size_t i{0}; i < len; ++i) {
+        const auto it{package_result.m_tx_results.find(package[i]->GetWitnessHash())};
+        results[i] = it == package_result.m_tx_results.end() ? btck_MempoolAcceptResult_UNFINISHED : cast_mempool_accept_result(it->second.m_result_type);
+    }
+    WriteRejectReason(package_result.m_state, reject_reason, user_data);
+    return package_result.m_state.IsValid() ? 0 : -1;
+}
+
+size_t btck_mempool_count_transactions(const btck_Mempool* mempool)
+{
+    return btck_Mempool::get(mempool).m_mempool->size();
+}
+
+size_t btck_mempool_get_usage(const btck_Mempool* mempool)
+{
+    return btck_Mempool::get(mempool).m_mempool->DynamicMemoryUsage();
+}
+
+int btck_mempool_contains(const btck_Mempool* mempool, const btck_Txid* txid)
+{
+    return btck_Mempool::get(mempool).m_mempool->exists(btck_Txid::get(txid)) ? 1 : 0;
+}
+
+btck_ChainstateManagerOptions* btck_chainstate_manager_options_create(const btck_Context* context, const char* data_dir, size_t data_dir_len, const char* blocks_dir, size_t blocks_dir_len)
+{
+    if (data_dir == nullptr || data_dir_len == 0 || blocks_dir == nullptr || blocks_dir_len == 0) {
+        LogError("Failed to create chainstate manager options: dir must be non-null and non-empty");
+        return nullptr;
+    }
+    try {
+        fs::path abs_data_dir{fs::absolute(fs::PathFromString({data_dir, data_dir_len}))};
+        fs::create_directories(abs_data_dir);
+        fs::path abs_blocks_dir{fs::absolute(fs::PathFromString({blocks_dir, blocks_dir_len}))};
+        fs::create_directories(abs_blocks_dir);
+        return btck_ChainstateManagerOptions::create(btck_Context::get(context), abs_data_dir, abs_blocks_dir);
+    } catch (const std::exception& e) {
+        LogError("Failed to create chainstate manager options: %s", e.what());
+        return nullptr;
+    }
+}
+
+void btck_chainstate_manager_options_set_worker_threads_num(btck_ChainstateManagerOptions* opts, int worker_threads)
+{
+    LOCK(btck_ChainstateManagerOptions::get(opts).m_mutex);
+    btck_ChainstateManagerOptions::get(opts).m_chainman_options.worker_threads_num = worker_threads;
+}
+
+void btck_chainstate_manager_options_set_total_cache_size(btck_ChainstateManagerOptions* chainman_opts, size_t total_cache_bytes)
+{
+    auto& opts{btck_ChainstateManagerOptions::get(chainman_opts)};
+    LOCK(opts.m_mutex);
+    opts.m_cache_sizes = kernel::CacheSizes{total_cache_bytes};
+    opts.m_blockman_options.block_tree_db_params.cache_bytes = opts.m_cache_sizes.block_tree_db;
+}
+
+void btck_chainstate_manager_options_set_cache_sizes(
+    btck_ChainstateManagerOptions* chainman_opts,
+    size_t block_tree_db_cache_bytes,
+    size_t coins_db_cache_bytes,
+    size_t coins_cache_bytes)
+{
+    auto& opts{btck_ChainstateManagerOptions::get(chainman_opts)};
+    LOCK(opts.m_mutex);
+    opts.m_cache_sizes.block_tree_db = block_tree_db_cache_bytes;
+    opts.m_cache_sizes.coins_db = coins_db_cache_bytes;
+    opts.m_cache_sizes.coins = coins_cache_bytes;
+    opts.m_blockman_options.block_tree_db_params.cache_bytes = block_tree_db_cache_bytes;
+}
+
+void btck_chainstate_manager_options_set_assumed_valid(btck_ChainstateManagerOptions* chainman_opts, const btck_BlockHash* block_hash)
+{
+    auto& opts{btck_ChainstateManagerOptions::get(chainman_opts)};
+    LOCK(opts.m_mutex);
+    opts.m_chainman_options.assumed_valid_block = btck_BlockHash::get(block_hash);
+}
+
+void btck_chainstate_manager_options_set_mempool(btck_ChainstateManagerOptions* chainman_opts, const btck_MempoolOptions* mempool_options)
+{
+    auto& opts{btck_ChainstateManagerOptions::get(chainman_opts)};
+    LOCK(opts.m_mutex);
+    opts.m_mempool_options = btck_MempoolOptions::get(mempool_options);
+}
+
+void btck_chainstate_manager_options_set_minimum_chain_work(btck_ChainstateManagerOptions* chainman_opts, const unsigned char minimum_chain_work[32])
+{
+    auto& opts{btck_ChainstateManagerOptions::get(chainman_opts)};
+    LOCK(opts.m_mutex);
+    opts.m_chainman_options.minimum_chain_work = UintToArith256(uint256{std::span<const unsigned char>{minimum_chain_work, 32}});
+}
+
+int btck_chainstate_manager_options_set_prune_target(btck_ChainstateManagerOptions* chainman_opts, uint64_t prune_target_bytes)
 {
-    if (data_dir == nullptr || data_dir_len == 0 || blocks_dir == nullptr || blocks_dir_len == 0) {
-        LogError("Failed to create chainstate manager options: dir must be non-null and non-empty");
-        return nullptr;
-    }
-    try {
-        fs::path abs_data_dir{fs::absolute(fs::PathFromString({data_dir, data_dir_len}))};
-        fs::create_directories(abs_data_dir);
-        fs::path abs_blocks_dir{fs::absolute(fs::PathFromString({blocks_dir, blocks_dir_len}))};
-        fs::create_directories(abs_blocks_dir);
-        return btck_ChainstateManagerOptions::create(btck_Context::get(context), abs_data_dir, abs_blocks_dir);
-    } catch (const std::exception& e) {
-        LogError("Failed to create chainstate manager options: %s", e.what());
-        return nullptr;
+    if (prune_target_bytes != 0 && prune_target_bytes != node::BlockManager::PRUNE_TARGET_MANUAL && prune_target_bytes < MIN_DISK_SPACE_FOR_BLOCK_FILES) {
+        LogError("Prune target of %d bytes is below the minimum of %d bytes.", prune_target_bytes, MIN_DISK_SPACE_FOR_BLOCK_FILES);
+        return -1;
     }
+    auto& opts{btck_ChainstateManagerOptions::get(chainman_opts)};
+    LOCK(opts.m_mutex);
+    opts.m_blockman_options.prune_target = prune_target_bytes;
+    return 0;
 }
 
-void btck_chainstate_manager_options_set_worker_threads_num(btck_ChainstateManagerOptions* opts, int worker_threads)
+void btck_chainstate_manager_options_set_fast_prune(btck_ChainstateManagerOptions* chainman_opts, int fast_prune)
 {
-    LOCK(btck_ChainstateManagerOptions::get(opts).m_mutex);
-    btck_ChainstateManagerOptions::get(opts).m_chainman_options.worker_threads_num = worker_threads;
+    auto& opts{btck_ChainstateManagerOptions::get(chainman_opts)};
+    LOCK(opts.m_mutex);
+    opts.m_blockman_options.fast_prune = fast_prune == 1;
 }
 
 void btck_chainstate_manager_options_destroy(btck_ChainstateManagerOptions* options)
@@ -1025,9 +2940,20 @@ btck_ChainstateManager* btck_chainstate_manager_create(
     const btck_ChainstateManagerOptions* chainman_opts)
 {
     auto& opts{btck_ChainstateManagerOptions::get(chainman_opts)};
+    std::unique_ptr<CTxMemPool> mempool;
     std::unique_ptr<ChainstateManager> chainman;
     try {
         LOCK(opts.m_mutex);
+        if (opts.m_mempool_options) {
+            auto mempool_opts{*opts.m_mempool_options};
+            mempool_opts.signals = opts.m_context->m_signals.get();
+            bilingual_str error;
+            mempool = std::make_unique<CTxMemPool>(std::move(mempool_opts), error);
+            if (!error.empty()) {
+                LogError("Failed to create mempool: %s", error.original);
+                return nullptr;
+            }
+        }
         chainman = std::make_unique<ChainstateManager>(*opts.m_context->m_interrupt, opts.m_chainman_options, opts.m_blockman_options);
     } catch (const std::exception& e) {
         LogError("Failed to create chainstate manager: %s", e.what());
@@ -1035,9 +2961,10 @@ btck_ChainstateManager* btck_chainstate_manager_create(
     }
 
     try {
-        const auto chainstate_load_opts{WITH_LOCK(opts.m_mutex, return opts.m_chainstate_load_options)};
+        auto chainstate_load_opts{WITH_LOCK(opts.m_mutex, return opts.m_chainstate_load_options)};
+        chainstate_load_opts.mempool = mempool.get();
+        const auto cache_sizes{WITH_LOCK(opts.m_mutex, return opts.m_cache_sizes)};
 
-        kernel::CacheSizes cache_sizes{DEFAULT_KERNEL_CACHE};
         auto [status, chainstate_err]{node::LoadChainstate(*chainman, cache_sizes, chainstate_load_opts)};
         if (status != node::ChainstateLoadStatus::SUCCESS) {
             LogError("Failed to load chain state from your data directory: %s", chainstate_err.original);
@@ -1057,164 +2984,594 @@ btck_ChainstateManager* btck_chainstate_manager_create(
         return nullptr;
     }
 
-    return btck_ChainstateManager::create(std::move(chainman), opts.m_context);
+    return btck_ChainstateManager::create(std::move(chainman), opts.m_context, std::move(mempool));
+}
+
+const btck_BlockTreeEntry* btck_chainstate_manager_get_block_tree_entry_by_hash(const btck_ChainstateManager* chainman, const btck_BlockHash* block_hash)
+{
+    auto block_index = WITH_LOCK(btck_ChainstateManager::get(chainman).m_chainman->GetMutex(),
+                                 return btck_ChainstateManager::get(chainman).m_chainman->m_blockman.LookupBlockIndex(btck_BlockHash::get(block_hash)));
+    if (!block_index) {
+        LogDebug(BCLog::KERNEL, "A block with the given hash is not indexed.");
+        return nullptr;
+    }
+    return btck_BlockTreeEntry::ref(block_index);
+}
+
+const btck_BlockTreeEntry* btck_chainstate_manager_get_best_entry(const btck_ChainstateManager* chainstate_manager)
+{
+    auto& chainman = *btck_ChainstateManager::get(chainstate_manager).m_chainman;
+    return btck_BlockTreeEntry::ref(WITH_LOCK(chainman.GetMutex(), return chainman.m_best_header));
+}
+
+btck_Coin* btck_chainstate_manager_get_coin(const btck_ChainstateManager* chainman, const btck_TransactionOutPoint* out_point)
+{
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    try {
+        // Peeking does not add the coin to the cache, so that lookups do not
+        // grow it until it has to be flushed.
+        auto coin{WITH_LOCK(chainstate_manager.GetMutex(), return chainstate_manager.ActiveChainstate().CoinsTip().PeekCoin(btck_TransactionOutPoint::get(out_point)))};
+        if (!coin) return nullptr;
+        return btck_Coin::create(std::move(*coin));
+    } catch (const std::exception& e) {
+        LogError("Failed to look up coin: %s", e.what());
+        return nullptr;
+    }
+}
+
+int btck_chainstate_manager_get_coins(const btck_ChainstateManager* chainman, const btck_TransactionOutPoint** out_points, size_t out_points_len, btck_Coin** coins)
+{
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    std::vector<std::optional<Coin>> results;
+    try {
+        results.reserve(out_points_len);
+        LOCK(chainstate_manager.GetMutex());
+        const CCoinsViewCache& coins_tip{chainstate_manager.ActiveChainstate().CoinsTip()};
+        for (size_t i{0}; i < out_points_len; ++i) {
+            results.push_back(coins_tip.PeekCoin(btck_TransactionOutPoint::get(out_points[i])));
+        }
+    } catch (const std::exception& e) {
+        LogError("Failed to look up coins: %s", e.what());
+        return -1;
+    }
+    for (size_t i{0}; i < out_points_len; ++i) {
+        coins[i] = results[i] ? btck_Coin::create(std::move(*results[i])) : nullptr;
+    }
+    return 0;
+}
+
+void btck_chainstate_manager_destroy(btck_ChainstateManager* chainman)
+{
+    std::unique_ptr<BlockSubmitQueue> submit_queue;
+    {
+        LOCK(btck_ChainstateManager::get(chainman).m_submit_mutex);
+        btck_ChainstateManager::get(chainman).m_destroying = true;
+        submit_queue = std::move(btck_ChainstateManager::get(chainman).m_submit_queue);
+    }
+    // The queue is drained without holding the lock, so that completion
+    // callbacks can try to submit blocks, which are rejected. The worker
+    // thread cannot join itself.
+    Assert(!submit_queue || !submit_queue->IsWorkerThread());
+    submit_queue.reset();
+    btck_ChainstateManager::get(chainman).m_coins_cursors->ReleaseAll();
+    {
+        // Reader worker threads read from the block manager.
+        auto& registry{*btck_ChainstateManager::get(chainman).m_block_readers};
+        LOCK(registry.m_mutex);
+        for (BlockRangeReader* reader : registry.m_readers) {
+            reader->Stop();
+        }
+        registry.m_readers.clear();
+    }
+    {
+        LOCK(btck_ChainstateManager::get(chainman).m_chainman->GetMutex());
+        for (const auto& chainstate : btck_ChainstateManager::get(chainman).m_chainman->m_chainstates) {
+            if (chainstate->CanFlushToDisk()) {
+                chainstate->ForceFlushStateToDisk();
+                chainstate->ResetCoinsViews();
+            }
+        }
+    }
+    // Held back tips and queued callbacks may refer to block tree entries of
+    // this chainstate manager.
+    if (const auto& notifications{btck_ChainstateManager::get(chainman).m_context->m_tip_limited_notifications}) {
+        notifications->DeliverHeldBack();
+    }
+    if (const auto& signals{btck_ChainstateManager::get(chainman).m_context->m_signals}) {
+        signals->FlushBackgroundCallbacks();
+    }
+
+    delete chainman;
+}
+
+int btck_chainstate_manager_import_blocks(btck_ChainstateManager* chainman, const char** block_file_paths_data, size_t* block_file_paths_lens, size_t block_file_paths_data_len)
+{
+    try {
+        std::vector<fs::path> import_files;
+        import_files.reserve(block_file_paths_data_len);
+        for (uint32_t i = 0; i < block_file_paths_data_len; i++) {
+            if (block_file_paths_data[i] != nullptr) {
+                import_files.emplace_back(std::string{block_file_paths_data[i], block_file_paths_lens[i]}.c_str());
+            }
+        }
+        auto& chainman_ref{*btck_ChainstateManager::get(chainman).m_chainman};
+        node::ImportBlocks(chainman_ref, import_files);
+        WITH_LOCK(::cs_main, chainman_ref.UpdateIBDStatus());
+    } catch (const std::exception& e) {
+        LogError("Failed to import blocks: %s", e.what());
+        return -1;
+    }
+    return 0;
+}
+
+int btck_chainstate_manager_import_blocks_parallel(btck_ChainstateManager* chainman, const char** block_file_paths_data, size_t* block_file_paths_lens, size_t block_file_paths_data_len,
+                                                    int threads, btck_ImportProgress progress, void* user_data)
+{
+    if (threads < 1) {
+        LogError("Import requires at least one thread, got %i.", threads);
+        return -1;
+    }
+    try {
+        std::vector<BlockSource> sources;
+        sources.reserve(block_file_paths_data_len);
+        for (size_t i = 0; i < block_file_paths_data_len; i++) {
+            fs::path path{std::string{block_file_paths_data[i], block_file_paths_lens[i]}.c_str()};
+            sources.push_back({fs::PathToString(path), [path]() -> ReadBytesFn {
+                auto file{std::make_shared<AutoFile>(fsbridge::fopen(path, "rb"))};
+                if (file->IsNull()) return {};
+                return [file](std::span<std::byte> dst) { return file->detail_fread(dst); };
+            }, path});
+        }
+        return ImportBlockSources(*btck_ChainstateManager::get(chainman).m_chainman, std::move(sources), threads, progress, user_data);
+    } catch (const std::exception& e) {
+        LogError("Failed to import blocks: %s", e.what());
+        return -1;
+    }
+}
+
+int btck_chainstate_manager_import_blocks_from_stream(btck_ChainstateManager* chainman, btck_ReadBytes read, int threads, btck_ImportProgress progress, void* user_data)
+{
+    if (threads < 1) {
+        LogError("Import requires at least one thread, got %i.", threads);
+        return -1;
+    }
+    BlockSource source{"block stream", [read, user_data]() -> ReadBytesFn {
+        return [read, user_data](std::span<std::byte> dst) {
+            const int64_t size{read(dst.data(), dst.size(), user_data)};
+            if (size < 0 || static_cast<uint64_t>(size) > dst.size()) {
+                throw std::runtime_error{"reading from the stream failed"};
+            }
+            return static_cast<size_t>(size);
+        };
+    }};
+    return ImportBlockSources(*btck_ChainstateManager::get(chainman).m_chainman, {std::move(source)}, threads, progress, user_data);
+}
+
+btck_Block* btck_block_create(const void* raw_block, size_t raw_block_length)
+{
+    if (raw_block == nullptr && raw_block_length != 0) {
+        return nullptr;
+    }
+    auto block{std::make_shared<CBlock>()};
+
+    SpanReader stream{std::span{reinterpret_cast<const std::byte*>(raw_block), raw_block_length}};
+
+    try {
+        stream >> TX_WITH_WITNESS(*block);
+    } catch (...) {
+        LogDebug(BCLog::KERNEL, "Block decode failed.");
+        return nullptr;
+    }
+
+    return btck_Block::create(block);
+}
+
+btck_Block* btck_block_copy(const btck_Block* block)
+{
+    return btck_Block::copy(block);
+}
+
+int btck_block_check(const btck_Block* block, const btck_ConsensusParams* consensus_params, btck_BlockCheckFlags flags, btck_BlockValidationState* validation_state)
+{
+    auto& state = btck_BlockValidationState::get(validation_state);
+    state = BlockValidationState{};
+
+    const bool check_pow    = (flags & btck_BlockCheckFlags_POW) != 0;
+    const bool check_merkle = (flags & btck_BlockCheckFlags_MERKLE) != 0;
+
+    const bool result = CheckBlock(*btck_Block::get(block), state, btck_ConsensusParams::get(consensus_params), /*fCheckPOW=*/check_pow, /*fCheckMerkleRoot=*/check_merkle);
+
+    return result ? 1 : 0;
+}
+
+size_t btck_block_count_transactions(const btck_Block* block)
+{
+    return btck_Block::get(block)->vtx.size();
+}
+
+const btck_Transaction* btck_block_get_transaction_at(const btck_Block* block, size_t index)
+{
+    assert(index < btck_Block::get(block)->vtx.size());
+    return btck_Transaction::ref(&btck_Block::get(block)->vtx[index]);
+}
+
+btck_BlockHeader* btck_block_get_header(const btck_Block* block)
+{
+    const auto& block_ptr = btck_Block::get(block);
+    return btck_BlockHeader::create(static_cast<const CBlockHeader&>(*block_ptr));
+}
+
+int btck_block_to_bytes(const btck_Block* block, btck_WriteBytes writer, void* user_data)
+{
+    try {
+        WriterStream ws{writer, user_data};
+        ws << TX_WITH_WITNESS(*btck_Block::get(block));
+        return 0;
+    } catch (...) {
+        return -1;
+    }
+}
+
+size_t btck_block_serialized_size(const btck_Block* block)
+{
+    return GetSerializeSize(TX_WITH_WITNESS(*btck_Block::get(block)));
+}
+
+int btck_block_to_buffer(const btck_Block* block, void* buffer, size_t buffer_len)
+{
+    try {
+        SpanWriter{std::span{reinterpret_cast<std::byte*>(buffer), buffer_len}} << TX_WITH_WITNESS(*btck_Block::get(block));
+        return 0;
+    } catch (const std::exception& e) {
+        LogError("Failed to serialize block into a buffer of %u bytes: %s", buffer_len, e.what());
+        return -1;
+    }
+}
+
+btck_BlockHash* btck_block_get_hash(const btck_Block* block)
+{
+    return btck_BlockHash::create(btck_Block::get(block)->GetHash());
+}
+
+void btck_block_destroy(btck_Block* block)
+{
+    delete block;
+}
+
+btck_BlockColumns* btck_block_columns_create(const btck_Block* block_, const btck_BlockSpentOutputs* spent_outputs)
+{
+    const CBlock& block{*btck_Block::get(block_)};
+    const CBlockUndo* block_undo{spent_outputs ? btck_BlockSpentOutputs::get(spent_outputs).get() : nullptr};
+    if (block_undo) {
+        if (block_undo->vtxundo.size() + 1 != block.vtx.size()) {
+            LogError("Spent outputs do not match the block.");
+            return nullptr;
+        }
+        for (size_t i = 1; i < block.vtx.size(); ++i) {
+            if (block_undo->vtxundo[i - 1].vprevout.size() != block.vtx[i]->vin.size()) {
+                LogError("Spent outputs do not match the block.");
+                return nullptr;
+            }
+        }
+    }
+    try {
+        return btck_BlockColumns::create(block, block_undo);
+    } catch (const std::exception& e) {
+        LogError("Failed to create block columns: %s", e.what());
+        return nullptr;
+    }
+}
+
+const void* btck_block_columns_get(const btck_BlockColumns* block_columns, btck_BlockColumn column, size_t* len)
+{
+    const auto& columns{btck_BlockColumns::get(block_columns)};
+    auto get{[&](const auto& data, size_t element_size = 1) -> const void* {
+        *len = data.size() / element_size;
+        return data.empty() ? nullptr : data.data();
+    }};
+    switch (column) {
+    case btck_BlockColumn_TX_INPUT_OFFSETS: return get(columns.tx_input_offsets);
+    case btck_BlockColumn_TX_OUTPUT_OFFSETS: return get(columns.tx_output_offsets);
+    case btck_BlockColumn_TXIDS: return get(columns.txids, uint256::size());
+    case btck_BlockColumn_INPUT_PREVOUT_TXIDS: return get(columns.input_prevout_txids, uint256::size());
+    case btck_BlockColumn_INPUT_PREVOUT_INDICES: return get(columns.input_prevout_indices);
+    case btck_BlockColumn_OUTPUT_AMOUNTS: return get(columns.output_amounts);
+    case btck_BlockColumn_OUTPUT_SCRIPT_OFFSETS: return get(columns.output_script_offsets);
+    case btck_BlockColumn_OUTPUT_SCRIPTS: return get(columns.output_scripts);
+    case btck_BlockColumn_SPENT_AMOUNTS: return get(columns.spent_amounts);
+    case btck_BlockColumn_SPENT_HEIGHTS: return get(columns.spent_heights);
+    case btck_BlockColumn_SPENT_IS_COINBASE: return get(columns.spent_is_coinbase);
+    case btck_BlockColumn_SPENT_SCRIPT_OFFSETS: return get(columns.spent_script_offsets);
+    case btck_BlockColumn_SPENT_SCRIPTS: return get(columns.spent_scripts);
+    }
+    assert(false);
+}
+
+void btck_block_columns_destroy(btck_BlockColumns* block_columns)
+{
+    delete block_columns;
+}
+
+int btck_block_read_with_spent_outputs(const btck_ChainstateManager* chainman, const btck_BlockTreeEntry* entry, btck_Block** block_out, btck_BlockSpentOutputs** spent_outputs_out)
+{
+    *block_out = nullptr;
+    *spent_outputs_out = nullptr;
+    auto block{std::make_shared<CBlock>()};
+    auto block_undo{std::make_shared<CBlockUndo>()};
+    if (!ReadBlockAndUndo(btck_ChainstateManager::get(chainman).m_chainman->m_blockman, btck_BlockTreeEntry::get(entry), *block, block_undo.get())) {
+        return -1;
+    }
+    *block_out = btck_Block::create(std::move(block));
+    *spent_outputs_out = btck_BlockSpentOutputs::create(std::move(block_undo));
+    return 0;
+}
+
+btck_Block* btck_block_read(const btck_ChainstateManager* chainman, const btck_BlockTreeEntry* entry)
+{
+    auto block{std::make_shared<CBlock>()};
+    if (!btck_ChainstateManager::get(chainman).m_chainman->m_blockman.ReadBlock(*block, btck_BlockTreeEntry::get(entry))) {
+        LogError("Failed to read block.");
+        return nullptr;
+    }
+    return btck_Block::create(block);
+}
+
+int btck_block_read_raw(const btck_ChainstateManager* chainman, const btck_BlockTreeEntry* entry, size_t offset, size_t len, btck_WriteBytes writer, void* user_data)
+{
+    if (len == 0 && offset != 0) {
+        LogError("Block part offset given without a length.");
+        return -1;
+    }
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    const CBlockIndex& block_index{btck_BlockTreeEntry::get(entry)};
+    FlatFilePos pos;
+    {
+        LOCK(chainstate_manager.GetMutex());
+        if (!(block_index.nStatus & BLOCK_HAVE_DATA)) {
+            LogError("Block data for %s is not available.", block_index.GetBlockHash().ToString());
+            return -1;
+        }
+        pos = block_index.GetBlockPos();
+    }
+
+    auto block_part{len == 0 ? std::nullopt : std::optional{std::pair{offset, len}}};
+    const auto block_data{chainstate_manager.m_blockman.ReadRawBlock(pos, block_part)};
+    if (!block_data) {
+        if (block_data.error() == node::ReadRawError::BadPartRange) {
+            LogError("Bad block part offset/size %u/%u.", offset, len);
+        }
+        return -1;
+    }
+    return writer(block_data->data(), block_data->size(), user_data) == 0 ? 0 : -1;
+}
+
+btck_BlockHeader* btck_block_tree_entry_get_block_header(const btck_BlockTreeEntry* entry)
+{
+    return btck_BlockHeader::create(btck_BlockTreeEntry::get(entry).GetBlockHeader());
 }
 
-const btck_BlockTreeEntry* btck_chainstate_manager_get_block_tree_entry_by_hash(const btck_ChainstateManager* chainman, const btck_BlockHash* block_hash)
+int32_t btck_block_tree_entry_get_height(const btck_BlockTreeEntry* entry)
 {
-    auto block_index = WITH_LOCK(btck_ChainstateManager::get(chainman).m_chainman->GetMutex(),
-                                 return btck_ChainstateManager::get(chainman).m_chainman->m_blockman.LookupBlockIndex(btck_BlockHash::get(block_hash)));
-    if (!block_index) {
-        LogDebug(BCLog::KERNEL, "A block with the given hash is not indexed.");
-        return nullptr;
-    }
-    return btck_BlockTreeEntry::ref(block_index);
+    return btck_BlockTreeEntry::get(entry).nHeight;
 }
 
-const btck_BlockTreeEntry* btck_chainstate_manager_get_best_entry(const btck_ChainstateManager* chainstate_manager)
+const btck_BlockHash* btck_block_tree_entry_get_block_hash(const btck_BlockTreeEntry* entry)
 {
-    auto& chainman = *btck_ChainstateManager::get(chainstate_manager).m_chainman;
-    return btck_BlockTreeEntry::ref(WITH_LOCK(chainman.GetMutex(), return chainman.m_best_header));
+    return btck_BlockHash::ref(btck_BlockTreeEntry::get(entry).phashBlock);
 }
 
-void btck_chainstate_manager_destroy(btck_ChainstateManager* chainman)
+int btck_block_tree_entry_equals(const btck_BlockTreeEntry* entry1, const btck_BlockTreeEntry* entry2)
 {
-    {
-        LOCK(btck_ChainstateManager::get(chainman).m_chainman->GetMutex());
-        for (const auto& chainstate : btck_ChainstateManager::get(chainman).m_chainman->m_chainstates) {
-            if (chainstate->CanFlushToDisk()) {
-                chainstate->ForceFlushStateToDisk();
-                chainstate->ResetCoinsViews();
-            }
-        }
+    return &btck_BlockTreeEntry::get(entry1) == &btck_BlockTreeEntry::get(entry2);
+}
+
+btck_CoinsCursor* btck_coins_cursor_create(const btck_ChainstateManager* chainman, uint32_t shard_index, uint32_t shard_count)
+{
+    if (shard_count == 0 || shard_index >= shard_count) {
+        LogError("Invalid coins cursor shard %u of %u.", shard_index, shard_count);
+        return nullptr;
     }
+    std::optional<Txid> end;
+    if (shard_index + 1 < shard_count) end = CoinsShardStart(shard_index + 1, shard_count);
 
-    delete chainman;
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    try {
+        LOCK(chainstate_manager.GetMutex());
+        Chainstate& chainstate{chainstate_manager.ActiveChainstate()};
+        chainstate.ForceFlushStateToDisk(/*wipe_cache=*/false);
+        const auto& registry{btck_ChainstateManager::get(chainman).m_coins_cursors};
+        return btck_CoinsCursor::create(registry, OpenCoinsCursor(chainstate, registry, CoinsShardStart(shard_index, shard_count)),
+                                        std::move(end));
+    } catch (const std::exception& e) {
+        LogError("Failed to create coins cursor: %s", e.what());
+        return nullptr;
+    }
 }
 
-int btck_chainstate_manager_import_blocks(btck_ChainstateManager* chainman, const char** block_file_paths_data, size_t* block_file_paths_lens, size_t block_file_paths_data_len)
+btck_BlockHash* btck_coins_cursor_get_best_block_hash(const btck_CoinsCursor* coins_cursor)
 {
+    return btck_BlockHash::create(btck_CoinsCursor::get(coins_cursor).m_best_block);
+}
+
+int btck_coins_cursor_next_batch(btck_CoinsCursor* coins_cursor, size_t batch_size, btck_TransactionOutPoint** out_points, btck_Coin** coins, size_t* batch_len)
+{
+    auto& cursor{btck_CoinsCursor::get(coins_cursor)};
+    LOCK(cursor.m_mutex);
+    if (!cursor.m_cursor) {
+        LogError("Failed to read from coins cursor: the chainstate database was closed.");
+        return -1;
+    }
+    std::vector<std::pair<COutPoint, Coin>> batch;
     try {
-        std::vector<fs::path> import_files;
-        import_files.reserve(block_file_paths_data_len);
-        for (uint32_t i = 0; i < block_file_paths_data_len; i++) {
-            if (block_file_paths_data[i] != nullptr) {
-                import_files.emplace_back(std::string{block_file_paths_data[i], block_file_paths_lens[i]}.c_str());
+        batch.reserve(batch_size);
+        COutPoint out_point;
+        Coin coin;
+        while (batch.size() < batch_size && cursor.m_cursor->Valid()) {
+            if (!cursor.m_cursor->GetKey(out_point)) {
+                throw std::runtime_error("Unable to read UTXO set key");
             }
+            if (cursor.m_end && out_point.hash >= *cursor.m_end) break;
+            if (!cursor.m_cursor->GetValue(coin)) {
+                throw std::runtime_error("Unable to read UTXO set value");
+            }
+            batch.emplace_back(out_point, std::move(coin));
+            cursor.m_cursor->Next();
         }
-        auto& chainman_ref{*btck_ChainstateManager::get(chainman).m_chainman};
-        node::ImportBlocks(chainman_ref, import_files);
-        WITH_LOCK(::cs_main, chainman_ref.UpdateIBDStatus());
     } catch (const std::exception& e) {
-        LogError("Failed to import blocks: %s", e.what());
+        LogError("Failed to read from coins cursor: %s", e.what());
         return -1;
     }
+    for (size_t i{0}; i < batch.size(); ++i) {
+        out_points[i] = btck_TransactionOutPoint::create(batch[i].first);
+        coins[i] = btck_Coin::create(std::move(batch[i].second));
+    }
+    *batch_len = batch.size();
     return 0;
 }
 
-btck_Block* btck_block_create(const void* raw_block, size_t raw_block_length)
+void btck_coins_cursor_destroy(btck_CoinsCursor* coins_cursor)
 {
-    if (raw_block == nullptr && raw_block_length != 0) {
+    delete coins_cursor;
+}
+
+btck_UtxoStats* btck_chainstate_manager_get_utxo_stats(btck_ChainstateManager* chainman, btck_UtxoHashType hash_type, int threads, btck_UtxoStatsProgress progress_callback, void* user_data)
+{
+    if (threads < 1) {
+        LogError("Invalid number of threads %d for computing UTXO set statistics.", threads);
         return nullptr;
     }
-    auto block{std::make_shared<CBlock>()};
-
-    SpanReader stream{std::span{reinterpret_cast<const std::byte*>(raw_block), raw_block_length}};
-
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    const auto& registry{btck_ChainstateManager::get(chainman).m_coins_cursors};
+    UtxoStatsProgress progress{progress_callback, user_data};
     try {
-        stream >> TX_WITH_WITNESS(*block);
-    } catch (...) {
-        LogDebug(BCLog::KERNEL, "Block decode failed.");
+        kernel::CoinStatsHashType stats_hash_type;
+        switch (hash_type) {
+        case btck_UtxoHashType_HASH_SERIALIZED:
+            stats_hash_type = kernel::CoinStatsHashType::HASH_SERIALIZED;
+            break;
+        case btck_UtxoHashType_MUHASH:
+            stats_hash_type = kernel::CoinStatsHashType::MUHASH;
+            break;
+        case btck_UtxoHashType_NONE:
+            stats_hash_type = kernel::CoinStatsHashType::NONE;
+            break;
+        default:
+            LogError("Invalid UTXO set hash type %d.", hash_type);
+            return nullptr;
+        }
+        std::optional<kernel::CCoinsStats> stats;
+        if (threads > 1 && stats_hash_type != kernel::CoinStatsHashType::HASH_SERIALIZED) {
+            stats = ComputeShardedUtxoStats(chainstate_manager, registry, stats_hash_type, threads, progress);
+        } else {
+            // The serialized hash depends on the order of the coins, so the
+            // database is scanned by a single thread. Single threaded scans
+            // use the same code as Bitcoin Core's gettxoutsetinfo.
+            SingleCursorCoinsView coins_view{WITH_LOCK(chainstate_manager.GetMutex(), {
+                Chainstate& chainstate{chainstate_manager.ActiveChainstate()};
+                chainstate.ForceFlushStateToDisk(/*wipe_cache=*/false);
+                return std::make_unique<RegisteredCoinsViewCursor>(registry, OpenCoinsCursor(chainstate, registry, Txid{}));
+            })};
+            uint64_t unreported{0};
+            stats = kernel::ComputeUTXOStats(stats_hash_type, &coins_view, chainstate_manager.m_blockman, [&] {
+                if (++unreported < UTXO_STATS_PROGRESS_INTERVAL) return;
+                if (chainstate_manager.m_interrupt) throw UtxoStatsInterrupted{};
+                progress.Add(unreported);
+                unreported = 0;
+            });
+            progress.Add(unreported);
+        }
+        if (!stats) {
+            LogError("Failed to compute UTXO set statistics.");
+            return nullptr;
+        }
+        return btck_UtxoStats::create(std::move(*stats));
+    } catch (const UtxoStatsInterrupted&) {
+        LogInfo("Interrupted while computing UTXO set statistics.");
+        return nullptr;
+    } catch (const std::exception& e) {
+        LogError("Failed to compute UTXO set statistics: %s", e.what());
         return nullptr;
     }
-
-    return btck_Block::create(block);
 }
 
-btck_Block* btck_block_copy(const btck_Block* block)
+int32_t btck_utxo_stats_get_height(const btck_UtxoStats* utxo_stats)
 {
-    return btck_Block::copy(block);
+    return btck_UtxoStats::get(utxo_stats).nHeight;
 }
 
-int btck_block_check(const btck_Block* block, const btck_ConsensusParams* consensus_params, btck_BlockCheckFlags flags, btck_BlockValidationState* validation_state)
+btck_BlockHash* btck_utxo_stats_get_block_hash(const btck_UtxoStats* utxo_stats)
 {
-    auto& state = btck_BlockValidationState::get(validation_state);
-    state = BlockValidationState{};
-
-    const bool check_pow    = (flags & btck_BlockCheckFlags_POW) != 0;
-    const bool check_merkle = (flags & btck_BlockCheckFlags_MERKLE) != 0;
-
-    const bool result = CheckBlock(*btck_Block::get(block), state, btck_ConsensusParams::get(consensus_params), /*fCheckPOW=*/check_pow, /*fCheckMerkleRoot=*/check_merkle);
-
-    return result ? 1 : 0;
+    return btck_BlockHash::create(btck_UtxoStats::get(utxo_stats).hashBlock);
 }
 
-size_t btck_block_count_transactions(const btck_Block* block)
+uint64_t btck_utxo_stats_get_transaction_count(const btck_UtxoStats* utxo_stats)
 {
-    return btck_Block::get(block)->vtx.size();
+    return btck_UtxoStats::get(utxo_stats).nTransactions;
 }
 
-const btck_Transaction* btck_block_get_transaction_at(const btck_Block* block, size_t index)
+uint64_t btck_utxo_stats_get_coins_count(const btck_UtxoStats* utxo_stats)
 {
-    assert(index < btck_Block::get(block)->vtx.size());
-    return btck_Transaction::ref(&btck_Block::get(block)->vtx[index]);
+    return btck_UtxoStats::get(utxo_stats).coins_count;
 }
 
-btck_BlockHeader* btck_block_get_header(const btck_Block* block)
+int btck_utxo_stats_get_total_amount(const btck_UtxoStats* utxo_stats, int64_t* total_amount)
 {
-    const auto& block_ptr = btck_Block::get(block);
-    return btck_BlockHeader::create(static_cast<const CBlockHeader&>(*block_ptr));
+    const auto& amount{btck_UtxoStats::get(utxo_stats).total_amount};
+    if (!amount) return -1;
+    *total_amount = *amount;
+    return 0;
 }
 
-int btck_block_to_bytes(const btck_Block* block, btck_WriteBytes writer, void* user_data)
+uint64_t btck_utxo_stats_get_bogo_size(const btck_UtxoStats* utxo_stats)
 {
-    try {
-        WriterStream ws{writer, user_data};
-        ws << TX_WITH_WITNESS(*btck_Block::get(block));
-        return 0;
-    } catch (...) {
-        return -1;
-    }
+    return btck_UtxoStats::get(utxo_stats).nBogoSize;
 }
 
-btck_BlockHash* btck_block_get_hash(const btck_Block* block)
+void btck_utxo_stats_get_hash(const btck_UtxoStats* utxo_stats, unsigned char output[32])
 {
-    return btck_BlockHash::create(btck_Block::get(block)->GetHash());
+    std::memcpy(output, btck_UtxoStats::get(utxo_stats).hashSerialized.begin(), 32);
 }
 
-void btck_block_destroy(btck_Block* block)
+void btck_utxo_stats_destroy(btck_UtxoStats* utxo_stats)
 {
-    delete block;
+    delete utxo_stats;
 }
 
-btck_Block* btck_block_read(const btck_ChainstateManager* chainman, const btck_BlockTreeEntry* entry)
+btck_BlockRangeReader* btck_block_range_reader_create(const btck_ChainstateManager* chainman, const btck_BlockTreeEntry** entries_, size_t entries_len, int with_spent_outputs, size_t prefetch, int worker_threads)
 {
-    auto block{std::make_shared<CBlock>()};
-    if (!btck_ChainstateManager::get(chainman).m_chainman->m_blockman.ReadBlock(*block, btck_BlockTreeEntry::get(entry))) {
-        LogError("Failed to read block.");
+    if (prefetch == 0) {
+        LogError("Block range reader prefetch must be at least 1.");
+        return nullptr;
+    }
+    try {
+        std::vector<const CBlockIndex*> entries;
+        entries.reserve(entries_len);
+        for (size_t i = 0; i < entries_len; i++) {
+            entries.push_back(&btck_BlockTreeEntry::get(entries_[i]));
+        }
+        const int threads{static_cast<int>(std::min<size_t>(std::max(worker_threads, 1), prefetch))};
+        const auto& chainman_ref{btck_ChainstateManager::get(chainman)};
+        return btck_BlockRangeReader::create(chainman_ref.m_block_readers, chainman_ref.m_chainman->m_blockman, std::move(entries), with_spent_outputs != 0, prefetch, threads);
+    } catch (const std::exception& e) {
+        LogError("Failed to create block range reader: %s", e.what());
         return nullptr;
     }
-    return btck_Block::create(block);
-}
-
-btck_BlockHeader* btck_block_tree_entry_get_block_header(const btck_BlockTreeEntry* entry)
-{
-    return btck_BlockHeader::create(btck_BlockTreeEntry::get(entry).GetBlockHeader());
-}
-
-int32_t btck_block_tree_entry_get_height(const btck_BlockTreeEntry* entry)
-{
-    return btck_BlockTreeEntry::get(entry).nHeight;
 }
 
-const btck_BlockHash* btck_block_tree_entry_get_block_hash(const btck_BlockTreeEntry* entry)
+int btck_block_range_reader_next(btck_BlockRangeReader* reader, btck_Block** block_out, btck_BlockSpentOutputs** spent_outputs_out)
 {
-    return btck_BlockHash::ref(btck_BlockTreeEntry::get(entry).phashBlock);
+    auto result{btck_BlockRangeReader::get(reader).Next()};
+    *block_out = nullptr;
+    if (spent_outputs_out) *spent_outputs_out = nullptr;
+    if (!result) return -1;
+    if (result->block) *block_out = btck_Block::create(std::move(result->block));
+    if (result->undo && spent_outputs_out) *spent_outputs_out = btck_BlockSpentOutputs::create(std::move(result->undo));
+    return 0;
 }
 
-int btck_block_tree_entry_equals(const btck_BlockTreeEntry* entry1, const btck_BlockTreeEntry* entry2)
+void btck_block_range_reader_destroy(btck_BlockRangeReader* reader)
 {
-    return &btck_BlockTreeEntry::get(entry1) == &btck_BlockTreeEntry::get(entry2);
+    delete reader;
 }
 
 btck_BlockHash* btck_block_hash_create(const unsigned char block_hash[32])
@@ -1338,6 +3695,30 @@ int btck_chainstate_manager_process_block(
     return result ? 0 : -1;
 }
 
+int btck_chainstate_manager_submit_block(
+    btck_ChainstateManager* chainstate_manager,
+    const btck_Block* block,
+    btck_BlockProcessed done,
+    void* user_data)
+{
+    try {
+        auto& chainman{btck_ChainstateManager::get(chainstate_manager)};
+        LOCK(chainman.m_submit_mutex);
+        if (chainman.m_destroying) {
+            LogError("Failed to submit block: the chainstate manager is being destroyed.");
+            return -1;
+        }
+        if (!chainman.m_submit_queue) {
+            chainman.m_submit_queue = std::make_unique<BlockSubmitQueue>(*chainman.m_chainman);
+        }
+        chainman.m_submit_queue->Submit(btck_Block::get(block), done, user_data);
+    } catch (const std::exception& e) {
+        LogError("Failed to submit block: %s", e.what());
+        return -1;
+    }
+    return 0;
+}
+
 int btck_chainstate_manager_process_block_header(
     btck_ChainstateManager* chainstate_manager,
     const btck_BlockHeader* header,
@@ -1354,11 +3735,226 @@ int btck_chainstate_manager_process_block_header(
     }
 }
 
+int btck_chainstate_manager_process_block_headers(
+    btck_ChainstateManager* chainstate_manager,
+    const btck_BlockHeader** headers,
+    size_t headers_len,
+    btck_BlockValidationState* state,
+    const btck_BlockTreeEntry** last_entry)
+{
+    try {
+        std::vector<CBlockHeader> block_headers;
+        block_headers.reserve(headers_len);
+        for (size_t i = 0; i < headers_len; i++) {
+            block_headers.push_back(btck_BlockHeader::get(headers[i]));
+        }
+        auto& chainman = btck_ChainstateManager::get(chainstate_manager).m_chainman;
+        const CBlockIndex* pindex{nullptr};
+        auto result = chainman->ProcessNewBlockHeaders(block_headers, /*min_pow_checked=*/true, btck_BlockValidationState::get(state), &pindex);
+        if (last_entry) {
+            *last_entry = pindex ? btck_BlockTreeEntry::ref(pindex) : nullptr;
+        }
+        return result ? 0 : -1;
+    } catch (const std::exception& e) {
+        LogError("Failed to process block headers: %s", e.what());
+        return -1;
+    }
+}
+
+int btck_chainstate_manager_process_raw_block_headers(
+    btck_ChainstateManager* chainstate_manager,
+    const void* raw_block_headers,
+    size_t raw_block_headers_len,
+    btck_BlockValidationState* state,
+    const btck_BlockTreeEntry** last_entry)
+{
+    std::vector<CBlockHeader> block_headers;
+    SpanReader stream{std::span{reinterpret_cast<const std::byte*>(raw_block_headers), raw_block_headers_len}};
+    try {
+        while (!stream.empty()) {
+            stream >> block_headers.emplace_back();
+        }
+    } catch (...) {
+        LogError("Block headers decode failed.");
+        return -1;
+    }
+
+    try {
+        auto& chainman = btck_ChainstateManager::get(chainstate_manager).m_chainman;
+        const CBlockIndex* pindex{nullptr};
+        auto result = chainman->ProcessNewBlockHeaders(block_headers, /*min_pow_checked=*/true, btck_BlockValidationState::get(state), &pindex);
+        if (last_entry) {
+            *last_entry = pindex ? btck_BlockTreeEntry::ref(pindex) : nullptr;
+        }
+        return result ? 0 : -1;
+    } catch (const std::exception& e) {
+        LogError("Failed to process block headers: %s", e.what());
+        return -1;
+    }
+}
+
 const btck_Chain* btck_chainstate_manager_get_active_chain(const btck_ChainstateManager* chainman)
 {
     return btck_Chain::ref(&WITH_LOCK(btck_ChainstateManager::get(chainman).m_chainman->GetMutex(), return btck_ChainstateManager::get(chainman).m_chainman->ActiveChain()));
 }
 
+btck_Mempool* btck_chainstate_manager_get_mempool(btck_ChainstateManager* chainman)
+{
+    if (!btck_ChainstateManager::get(chainman).m_mempool) return nullptr;
+    return btck_Mempool::ref(&btck_ChainstateManager::get(chainman));
+}
+
+const btck_BlockTreeEntry* btck_chainstate_manager_activate_snapshot(btck_ChainstateManager* chainman, const char* path, size_t path_len)
+{
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    try {
+        const fs::path snapshot_path{fs::PathFromString(std::string{path, path_len})};
+        AutoFile file{fsbridge::fopen(snapshot_path, "rb")};
+        if (file.IsNull()) {
+            LogError("Failed to open snapshot file %s", fs::PathToString(snapshot_path));
+            return nullptr;
+        }
+        node::SnapshotMetadata metadata{chainstate_manager.GetParams().MessageStart()};
+        file >> metadata;
+        auto result{chainstate_manager.ActivateSnapshot(file, metadata, /*in_memory=*/false)};
+        if (!result) {
+            LogError("Failed to activate snapshot: %s", util::ErrorString(result).original);
+            return nullptr;
+        }
+        return btck_BlockTreeEntry::ref(*result);
+    } catch (const std::exception& e) {
+        LogError("Failed to load snapshot: %s", e.what());
+        return nullptr;
+    }
+}
+
+int btck_chainstate_manager_prune_to_height(btck_ChainstateManager* chainman, int32_t height)
+{
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    if (!chainstate_manager.m_blockman.IsPruneMode()) {
+        LogError("Cannot prune blocks, pruning is not enabled.");
+        return -1;
+    }
+    if (height <= 0) {
+        LogError("Invalid prune height %d.", height);
+        return -1;
+    }
+    try {
+        // The same as PruneBlockFilesManual, without swallowing flush failures.
+        LOCK(chainstate_manager.GetMutex());
+        BlockValidationState state;
+        if (!chainstate_manager.ActiveChainstate().FlushStateToDisk(state, FlushStateMode::NONE, height)) {
+            LogError("Failed to flush state after pruning blocks: %s", state.ToString());
+            return -1;
+        }
+    } catch (const std::exception& e) {
+        LogError("Failed to prune blocks: %s", e.what());
+        return -1;
+    }
+    return 0;
+}
+
+const btck_BlockTreeEntry* btck_chainstate_manager_dump_snapshot(btck_ChainstateManager* chainman, const char* path, size_t path_len, uint64_t* coins_written)
+{
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    const fs::path snapshot_path{fs::PathFromString(std::string{path, path_len})};
+    const fs::path temp_path{snapshot_path + ".incomplete"};
+    try {
+        std::unique_ptr<CCoinsViewCursor> cursor;
+        const CBlockIndex* base;
+        {
+            // Leveldb cursors iterate over a snapshot of the database, so
+            // blocks processed while the coins are written do not affect them.
+            LOCK(chainstate_manager.GetMutex());
+            Chainstate& chainstate{chainstate_manager.ActiveChainstate()};
+            chainstate.ForceFlushStateToDisk(/*wipe_cache=*/false);
+            const auto& registry{btck_ChainstateManager::get(chainman).m_coins_cursors};
+            cursor = std::make_unique<RegisteredCoinsViewCursor>(registry, OpenCoinsCursor(chainstate, registry, Txid{}));
+            base = chainstate_manager.m_blockman.LookupBlockIndex(cursor->GetBestBlock());
+        }
+        if (!base) {
+            LogError("Failed to dump snapshot: the best block of the chainstate is not indexed.");
+            return nullptr;
+        }
+
+        AutoFile file{fsbridge::fopen(temp_path, "wb")};
+        if (file.IsNull()) {
+            LogError("Failed to open snapshot file %s", fs::PathToString(temp_path));
+            return nullptr;
+        }
+        // The number of coins is only known once they were all written, so
+        // the metadata is written again with it at the end. Its serialized
+        // size does not depend on the count.
+        node::SnapshotMetadata metadata{chainstate_manager.GetParams().MessageStart(), base->GetBlockHash(), 0};
+        file << metadata;
+
+        // Coins are grouped by txid in the snapshot format, which the txid
+        // ordering of the database keys allows doing in a single pass.
+        std::vector<std::pair<uint32_t, Coin>> tx_coins;
+        Txid tx_hash;
+        const auto write_tx_coins{[&] {
+            file << tx_hash;
+            WriteCompactSize(file, tx_coins.size());
+            for (const auto& [n, coin] : tx_coins) {
+                WriteCompactSize(file, n);
+                file << coin;
+            }
+            metadata.m_coins_count += tx_coins.size();
+            tx_coins.clear();
+        }};
+        COutPoint key;
+        Coin coin;
+        for (uint64_t i{0}; cursor->Valid(); cursor->Next(), ++i) {
+            if (i % 5000 == 0 && chainstate_manager.m_interrupt) {
+                LogInfo("Interrupted while dumping snapshot to %s", fs::PathToString(snapshot_path));
+                (void)file.fclose();
+                fs::remove(temp_path);
+                return nullptr;
+            }
+            // Skipping a coin would silently produce an incomplete snapshot.
+            if (!cursor->GetKey(key) || !cursor->GetValue(coin)) {
+                throw std::runtime_error("Unable to read UTXO set");
+            }
+            if (!tx_coins.empty() && key.hash != tx_hash) write_tx_coins();
+            tx_hash = key.hash;
+            tx_coins.emplace_back(key.n, std::move(coin));
+        }
+        if (!tx_coins.empty()) write_tx_coins();
+
+        file.seek(0, SEEK_SET);
+        file << metadata;
+        if (file.fclose() != 0) {
+            throw std::ios_base::failure(strprintf("Error closing %s", fs::PathToString(temp_path)));
+        }
+        fs::rename(temp_path, snapshot_path);
+
+        LogInfo("Dumped %d coins at height %d to snapshot %s", metadata.m_coins_count, base->nHeight, fs::PathToString(snapshot_path));
+        if (coins_written) *coins_written = metadata.m_coins_count;
+        return btck_BlockTreeEntry::ref(base);
+    } catch (const std::exception& e) {
+        LogError("Failed to dump snapshot: %s", e.what());
+        std::error_code ec;
+        fs::remove(temp_path, ec);
+        return nullptr;
+    }
+}
+
+const btck_Chain* btck_chainstate_manager_get_background_chain(const btck_ChainstateManager* chainman)
+{
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    LOCK(chainstate_manager.GetMutex());
+    const Chainstate* chainstate{chainstate_manager.HistoricalChainstate()};
+    return chainstate ? btck_Chain::ref(&chainstate->m_chain) : nullptr;
+}
+
+const btck_BlockTreeEntry* btck_chainstate_manager_get_background_target(const btck_ChainstateManager* chainman)
+{
+    auto& chainstate_manager{*btck_ChainstateManager::get(chainman).m_chainman};
+    LOCK(chainstate_manager.GetMutex());
+    const Chainstate* chainstate{chainstate_manager.HistoricalChainstate()};
+    return chainstate ? btck_BlockTreeEntry::ref(chainstate->TargetBlock()) : nullptr;
+}
+
 int32_t btck_chain_get_height(const btck_Chain* chain)
 {
     LOCK(::cs_main);
@@ -1377,6 +3973,60 @@ int btck_chain_contains(const btck_Chain* chain, const btck_BlockTreeEntry* entr
     return btck_Chain::get(chain).Contains(btck_BlockTreeEntry::get(entry)) ? 1 : 0;
 }
 
+btck_ChainSnapshot* btck_chain_snapshot_create(const btck_Chain* chain_)
+{
+    try {
+        LOCK(::cs_main);
+        const CChain& chain{btck_Chain::get(chain_)};
+        std::vector<const CBlockIndex*> entries;
+        entries.reserve(chain.Height() + 1);
+        for (int height = 0; height <= chain.Height(); ++height) {
+            entries.push_back(chain[height]);
+        }
+        return btck_ChainSnapshot::create(std::move(entries));
+    } catch (const std::exception& e) {
+        LogError("Failed to create chain snapshot: %s", e.what());
+        return nullptr;
+    }
+}
+
+int32_t btck_chain_snapshot_get_height(const btck_ChainSnapshot* chain_snapshot)
+{
+    return static_cast<int32_t>(btck_ChainSnapshot::get(chain_snapshot).size()) - 1;
+}
+
+const btck_BlockTreeEntry* btck_chain_snapshot_get_by_height(const btck_ChainSnapshot* chain_snapshot, int32_t height)
+{
+    const auto& entries{btck_ChainSnapshot::get(chain_snapshot)};
+    if (height < 0 || static_cast<size_t>(height) >= entries.size()) {
+        return nullptr;
+    }
+    return btck_BlockTreeEntry::ref(entries[height]);
+}
+
+size_t btck_chain_snapshot_get_range(const btck_ChainSnapshot* chain_snapshot, int32_t start_height, int32_t stop_height, const btck_BlockTreeEntry** entries_out)
+{
+    const auto& entries{btck_ChainSnapshot::get(chain_snapshot)};
+    const auto start{static_cast<size_t>(std::max(start_height, 0))};
+    const auto stop{std::min(static_cast<size_t>(std::max(stop_height, 0)), entries.size())};
+    for (size_t height = start; height < stop; ++height) {
+        entries_out[height - start] = btck_BlockTreeEntry::ref(entries[height]);
+    }
+    return stop > start ? stop - start : 0;
+}
+
+int btck_chain_snapshot_contains(const btck_ChainSnapshot* chain_snapshot, const btck_BlockTreeEntry* entry)
+{
+    const auto& entries{btck_ChainSnapshot::get(chain_snapshot)};
+    const CBlockIndex& index{btck_BlockTreeEntry::get(entry)};
+    return index.nHeight >= 0 && static_cast<size_t>(index.nHeight) < entries.size() && entries[index.nHeight] == &index ? 1 : 0;
+}
+
+void btck_chain_snapshot_destroy(btck_ChainSnapshot* chain_snapshot)
+{
+    delete chain_snapshot;
+}
+
 btck_BlockHeader* btck_block_header_create(const void* raw_block_header, size_t raw_block_header_len)
 {
     if (raw_block_header == nullptr && raw_block_header_len != 0) {
@@ -242,6 +242,14 @@ typedef struct btck_ConsensusParams btck_ConsensusParams;
  */
 typedef struct btck_Chain btck_Chain;
 
+/**
+ * Opaque data structure for holding a copy of a chain taken at a point in time.
+ *
+ * Unlike btck_Chain, it does not change when the chain does, and reading from
+ * it does not take any locks.
+ */
+typedef struct btck_ChainSnapshot btck_ChainSnapshot;
+
 /**
  * Opaque data structure for holding a block's spent outputs.
  *
@@ -315,6 +323,67 @@ typedef struct btck_Txid btck_Txid;
  */
 typedef struct btck_BlockHeader btck_BlockHeader;
 
+/**
+ * Opaque data structure for holding statistics about the UTXO set.
+ */
+typedef struct btck_UtxoStats btck_UtxoStats;
+
+/**
+ * Opaque data structure for holding a cursor over the UTXO set.
+ *
+ * Iterates over a consistent snapshot of the chainstate database, optionally
+ * restricted to a shard of the txid space.
+ */
+typedef struct btck_CoinsCursor btck_CoinsCursor;
+
+/**
+ * Opaque data structure for reading a sequence of blocks from disk.
+ *
+ * Reads and deserializes blocks ahead of the caller on background threads,
+ * while returning them in the requested order.
+ */
+typedef struct btck_BlockRangeReader btck_BlockRangeReader;
+
+/**
+ * Opaque data structure for holding the contents of a block flattened into
+ * contiguous arrays, one per field.
+ */
+typedef struct btck_BlockColumns btck_BlockColumns;
+
+/**
+ * Opaque data structure for holding a pool of script verification threads.
+ *
+ * Used to verify the inputs of a transaction in parallel. Only one
+ * verification can use the pool at a time, concurrent verifications wait for
+ * their turn.
+ */
+typedef struct btck_ScriptCheckQueue btck_ScriptCheckQueue;
+
+/**
+ * Opaque data structure for holding signature and script execution caches.
+ *
+ * Remembers successful signature verifications and fully verified
+ * transactions, so that verifying them again is cheap. Safe to share between
+ * threads.
+ */
+typedef struct btck_SignatureCache btck_SignatureCache;
+
+/**
+ * Opaque data structure for holding options for a mempool hosted by a
+ * chainstate manager.
+ */
+typedef struct btck_MempoolOptions btck_MempoolOptions;
+
+/**
+ * Opaque data structure for holding a mempool.
+ *
+ * A mempool is created together with the chainstate manager hosting it. It
+ * validates unconfirmed transactions against the active chainstate and the
+ * node's policy. Transactions are removed once they are confirmed, and the
+ * least valuable ones are evicted once the mempool is full.
+ */
+typedef struct btck_Mempool btck_Mempool;
+
 /** Current sync state passed to tip changed callbacks. */
 typedef uint8_t btck_SynchronizationState;
 #define btck_SynchronizationState_INIT_REINDEX ((btck_SynchronizationState)(0))
@@ -358,6 +427,16 @@ typedef void (*btck_ValidationInterfacePoWValidBlock)(void* user_data, btck_Bloc
 typedef void (*btck_ValidationInterfaceBlockConnected)(void* user_data, btck_Block* block, const btck_BlockTreeEntry* entry);
 typedef void (*btck_ValidationInterfaceBlockDisconnected)(void* user_data, btck_Block* block, const btck_BlockTreeEntry* entry);
 
+/**
+ * Function signatures for the validation interface taking a borrowed block,
+ * which is only valid for the duration of the callback and must not be
+ * destroyed.
+ */
+typedef void (*btck_ValidationInterfaceBorrowedBlockChecked)(void* user_data, const btck_Block* block, const btck_BlockValidationState* state);
+typedef void (*btck_ValidationInterfaceBorrowedPoWValidBlock)(void* user_data, const btck_Block* block, const btck_BlockTreeEntry* entry);
+typedef void (*btck_ValidationInterfaceBorrowedBlockConnected)(void* user_data, const btck_Block* block, const btck_BlockTreeEntry* entry);
+typedef void (*btck_ValidationInterfaceBorrowedBlockDisconnected)(void* user_data, const btck_Block* block, const btck_BlockTreeEntry* entry);
+
 /**
  * Function signature for serializing data.
  *
@@ -365,6 +444,35 @@ typedef void (*btck_ValidationInterfaceBlockDisconnected)(void* user_data, btck_
  */
 typedef int (*btck_WriteBytes)(const void* bytes, size_t size, void* userdata);
 
+/**
+ * Function signature for reporting the progress of scanning the UTXO set,
+ * with the number of coins scanned so far.
+ */
+typedef void (*btck_UtxoStatsProgress)(void* user_data, uint64_t coins_processed);
+
+/**
+ * Function signature for reading data into a buffer of the given size.
+ *
+ * Returns the number of bytes read, 0 at the end of the stream, or a negative
+ * value on error.
+ */
+typedef int64_t (*btck_ReadBytes)(void* buffer, size_t size, void* user_data);
+
+/**
+ * Function signature for reporting the result of processing a submitted block.
+ * The result and new_block have the same meaning as the return value and
+ * new_block of btck_chainstate_manager_process_block.
+ */
+typedef void (*btck_BlockProcessed)(void* user_data, int result, int new_block);
+
+/**
+ * Function signature for reporting the progress of importing blocks, with the
+ * number and serialized size of the blocks imported so far, and the average
+ * rates since the import started.
+ */
+typedef void (*btck_ImportProgress)(void* user_data, uint64_t blocks_imported, uint64_t bytes_imported,
+                                    double blocks_per_second, double bytes_per_second);
+
 /**
  * Whether a validated data structure is valid, invalid, or an error was
  * encountered during processing.
@@ -395,16 +503,22 @@ typedef uint32_t btck_BlockValidationResult;
  * execution when they are called.
  */
 typedef struct {
-    void* user_data;                                              //!< Holds a user-defined opaque structure that is passed to the validation
-                                                                  //!< interface callbacks. If user_data_destroy is also defined ownership of the
-                                                                  //!< user_data is passed to the created context options and subsequently context.
-    btck_DestroyCallback user_data_destroy;                       //!< Frees the provided user data structure.
-    btck_ValidationInterfaceBlockChecked block_checked;           //!< Called when a new block has been fully validated. Contains the
-                                                                  //!< result of its validation.
-    btck_ValidationInterfacePoWValidBlock pow_valid_block;        //!< Called when a new block extends the header chain and has a valid transaction
-                                                                  //!< and segwit merkle root.
-    btck_ValidationInterfaceBlockConnected block_connected;       //!< Called when a block is valid and has now been connected to the best chain.
-    btck_ValidationInterfaceBlockDisconnected block_disconnected; //!< Called during a re-org when a block has been removed from the best chain.
+    void* user_data;                                                               //!< Holds a user-defined opaque structure that is passed to the validation
+                                                                                   //!< interface callbacks. If user_data_destroy is also defined ownership of the
+                                                                                   //!< user_data is passed to the created context options and subsequently context.
+    btck_DestroyCallback user_data_destroy;                                        //!< Frees the provided user data structure.
+    btck_ValidationInterfaceBlockChecked block_checked;                            //!< Called when a new block has been fully validated. Contains the
+                                                                                   //!< result of its validation.
+    btck_ValidationInterfacePoWValidBlock pow_valid_block;                         //!< Called when a new block extends the header chain and has a valid transaction
+                                                                                   //!< and segwit merkle root.
+    btck_ValidationInterfaceBlockConnected block_connected;                        //!< Called when a block is valid and has now been connected to the best chain.
+    btck_ValidationInterfaceBlockDisconnected block_disconnected;                  //!< Called during a re-org when a block has been removed from the best chain.
+    btck_ValidationInterfaceBorrowedBlockChecked borrowed_block_checked;           //!< Like block_checked, but the block is borrowed instead of owned. Use
+                                                                                   //!< btck_block_copy to retain it. This avoids allocating a block handle per
+                                                                                   //!< callback.
+    btck_ValidationInterfaceBorrowedPoWValidBlock borrowed_pow_valid_block;        //!< Like pow_valid_block, but the block is borrowed instead of owned.
+    btck_ValidationInterfaceBorrowedBlockConnected borrowed_block_connected;       //!< Like block_connected, but the block is borrowed instead of owned.
+    btck_ValidationInterfaceBorrowedBlockDisconnected borrowed_block_disconnected; //!< Like block_disconnected, but the block is borrowed instead of owned.
 } btck_ValidationInterfaceCallbacks;
 
 /**
@@ -477,6 +591,7 @@ typedef uint8_t btck_ScriptVerifyStatus;
 #define btck_ScriptVerifyStatus_OK ((btck_ScriptVerifyStatus)(0))
 #define btck_ScriptVerifyStatus_ERROR_INVALID_FLAGS_COMBINATION ((btck_ScriptVerifyStatus)(1)) //!< The flags were combined in an invalid way.
 #define btck_ScriptVerifyStatus_ERROR_SPENT_OUTPUTS_REQUIRED ((btck_ScriptVerifyStatus)(2))    //!< The taproot flag was set, so valid spent_outputs have to be provided.
+#define btck_ScriptVerifyStatus_ERROR_SPENT_OUTPUTS_MISMATCH ((btck_ScriptVerifyStatus)(3))    //!< The number of spent_outputs does not match the number of inputs.
 
 /**
  * Script verification flags that may be composed with each other.
@@ -545,6 +660,29 @@ BITCOINKERNEL_API int btck_transaction_to_bytes(
     btck_WriteBytes writer,
     void* user_data) BITCOINKERNEL_ARG_NONNULL(1, 2);
 
+/**
+ * @brief Get the size of the consensus serialization of the transaction.
+ *
+ * @param[in] transaction Non-null.
+ * @return                The serialized size in bytes.
+ */
+BITCOINKERNEL_API size_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_transaction_serialized_size(
+    const btck_Transaction* transaction) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Serializes the transaction into the passed in buffer. This is the
+ * same serialization as btck_transaction_to_bytes, written in a single pass.
+ *
+ * @param[in] transaction Non-null.
+ * @param[out] buffer     Non-null, buffer the serialized transaction is written to.
+ * @param[in] buffer_len  Length of the buffer, must be at least btck_transaction_serialized_size.
+ * @return                0 on success, non-zero if the buffer is too small.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_transaction_to_buffer(
+    const btck_Transaction* transaction,
+    void* buffer,
+    size_t buffer_len) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
 /**
  * @brief Get the number of outputs of a transaction.
  *
@@ -606,6 +744,33 @@ BITCOINKERNEL_API uint32_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_transaction_get
 BITCOINKERNEL_API const btck_Txid* BITCOINKERNEL_WARN_UNUSED_RESULT btck_transaction_get_txid(
     const btck_Transaction* transaction) BITCOINKERNEL_ARG_NONNULL(1);
 
+/**
+ * @brief Verify all inputs of a transaction against the outputs they spend
+ * under the constraints specified by flags. If a script check queue is passed,
+ * the inputs are verified in parallel on its worker threads. If a signature
+ * cache is passed, a transaction that was previously found valid with the same
+ * spent outputs and flags is not verified again.
+ *
+ * @param[in] tx_to              Non-null, the transaction to verify.
+ * @param[in] spent_outputs      Non-null, array of the outputs spent by the transaction, in input order.
+ * @param[in] spent_outputs_len  Length of the spent_outputs array, must equal the number of inputs.
+ * @param[in] flags              Bitfield of btck_ScriptVerificationFlags controlling validation constraints.
+ * @param[in] script_check_queue Nullable, verifies the inputs on the calling thread if null.
+ * @param[in] signature_cache    Nullable, cache to look up and store verification results in.
+ * @param[out] results           Nullable, array that will be populated with 1 for each valid input and 0 for
+ *                               each invalid one. Must hold as many elements as the transaction has inputs.
+ * @param[out] status            Nullable, will be set to an error code if the operation fails, or OK otherwise.
+ * @return                       1 if all inputs are valid, 0 otherwise.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_transaction_verify_inputs(
+    const btck_Transaction* tx_to,
+    const btck_TransactionOutput** spent_outputs, size_t spent_outputs_len,
+    btck_ScriptVerificationFlags flags,
+    btck_ScriptCheckQueue* script_check_queue,
+    btck_SignatureCache* signature_cache,
+    int* results,
+    btck_ScriptVerifyStatus* status) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
 /**
  * Destroy the transaction.
  */
@@ -647,6 +812,64 @@ BITCOINKERNEL_API void btck_precomputed_transaction_data_destroy(btck_Precompute
 
 ///@}
 
+/** @name ScriptCheckQueue
+ * Functions for working with script check queues.
+ */
+///@{
+
+/**
+ * @brief Create a script check queue. The calling thread of a verification
+ * always participates in it, so the total parallelism is one more than the
+ * number of worker threads.
+ *
+ * @param[in] worker_threads The number of worker threads to spawn. Clamped between 0 and 15.
+ * @return                   The script check queue, or null on error.
+ */
+BITCOINKERNEL_API btck_ScriptCheckQueue* BITCOINKERNEL_WARN_UNUSED_RESULT btck_script_check_queue_create(
+    int worker_threads);
+
+/**
+ * Destroy the script check queue, joining its worker threads.
+ */
+BITCOINKERNEL_API void btck_script_check_queue_destroy(btck_ScriptCheckQueue* script_check_queue);
+
+///@}
+
+/** @name SignatureCache
+ * Functions for working with signature caches.
+ */
+///@{
+
+/**
+ * @brief Create a signature cache. The byte sizes are upper bounds on the
+ * memory used by each of the caches.
+ *
+ * @param[in] signature_cache_bytes        Size of the cache of valid signatures.
+ * @param[in] script_execution_cache_bytes Size of the cache of fully verified transactions.
+ * @return                                 The signature cache, or null on error.
+ */
+BITCOINKERNEL_API btck_SignatureCache* BITCOINKERNEL_WARN_UNUSED_RESULT btck_signature_cache_create(
+    size_t signature_cache_bytes,
+    size_t script_execution_cache_bytes);
+
+/**
+ * @brief Get the number of lookups answered from the signature cache, and of
+ * transactions whose verification was skipped because they were found in the
+ * script execution cache.
+ *
+ * @param[in] signature_cache Non-null.
+ * @return                    The number of cache hits since creation.
+ */
+BITCOINKERNEL_API uint64_t btck_signature_cache_get_hits(
+    const btck_SignatureCache* signature_cache) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * Destroy the signature cache.
+ */
+BITCOINKERNEL_API void btck_signature_cache_destroy(btck_SignatureCache* signature_cache);
+
+///@}
+
 /** @name ScriptPubkey
  * Functions for working with script pubkeys.
  */
@@ -697,6 +920,30 @@ BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_script_pubkey_verify
     btck_ScriptVerificationFlags flags,
     btck_ScriptVerifyStatus* status) BITCOINKERNEL_ARG_NONNULL(1, 3);
 
+/**
+ * @brief Same as @ref btck_script_pubkey_verify, but looks up and stores valid
+ * signatures in a signature cache.
+ *
+ * @param[in] script_pubkey      Non-null, script pubkey to be spent.
+ * @param[in] amount             Amount of the script pubkey's associated output.
+ * @param[in] tx_to              Non-null, transaction spending the script_pubkey.
+ * @param[in] precomputed_txdata Nullable if the taproot flag is not set, see @ref btck_script_pubkey_verify.
+ * @param[in] input_index        Index of the input in tx_to spending the script_pubkey.
+ * @param[in] flags              Bitfield of btck_ScriptVerificationFlags controlling validation constraints.
+ * @param[in] signature_cache    Nullable, cache to look up and store valid signatures in.
+ * @param[out] status            Nullable, will be set to an error code if the operation fails, or OK otherwise.
+ * @return                       1 if the script is valid, 0 otherwise.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_script_pubkey_verify_cached(
+    const btck_ScriptPubkey* script_pubkey,
+    int64_t amount,
+    const btck_Transaction* tx_to,
+    const btck_PrecomputedTransactionData* precomputed_txdata,
+    unsigned int input_index,
+    btck_ScriptVerificationFlags flags,
+    btck_SignatureCache* signature_cache,
+    btck_ScriptVerifyStatus* status) BITCOINKERNEL_ARG_NONNULL(1, 3);
+
 /**
  * @brief Serializes the script pubkey through the passed in callback to bytes.
  *
@@ -875,6 +1122,27 @@ BITCOINKERNEL_API btck_ChainParameters* BITCOINKERNEL_WARN_UNUSED_RESULT btck_ch
 BITCOINKERNEL_API btck_ChainParameters* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chain_parameters_copy(
     const btck_ChainParameters* chain_parameters) BITCOINKERNEL_ARG_NONNULL(1);
 
+/**
+ * @brief Allow loading a UTXO snapshot at an additional height with
+ * @ref btck_chainstate_manager_activate_snapshot, e.g. a snapshot of a test
+ * chain written by @ref btck_chainstate_manager_dump_snapshot.
+ *
+ * @param[in] chain_parameters Non-null.
+ * @param[in] height           Height of the snapshot's base block, must be positive.
+ * @param[in] block_hash       Non-null, hash of the snapshot's base block.
+ * @param[in] hash_serialized  Non-null, the expected 32 byte btck_UtxoHashType_HASH_SERIALIZED hash of
+ *                             the UTXO set at the base block.
+ * @param[in] chain_tx_count   Number of transactions in the chain up to and including the base block.
+ * @return                     0 on success, non-zero if there already is a snapshot at the height or
+ *                             with the base block, or the height is invalid.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chain_parameters_add_assumeutxo(
+    btck_ChainParameters* chain_parameters,
+    int32_t height,
+    const btck_BlockHash* block_hash,
+    const unsigned char hash_serialized[32],
+    uint64_t chain_tx_count) BITCOINKERNEL_ARG_NONNULL(1, 3, 4);
+
 /**
  * @brief Get btck_ConsensusParams from btck_ChainParameters. The returned
  * btck_ConsensusParams pointer is valid only for the lifetime of the
@@ -925,6 +1193,31 @@ BITCOINKERNEL_API void btck_context_options_set_notifications(
     btck_ContextOptions* context_options,
     btck_NotificationInterfaceCallbacks notifications) BITCOINKERNEL_ARG_NONNULL(1);
 
+/**
+ * @brief Limit how often the block_tip and header_tip notifications are
+ * delivered, e.g. to avoid a callback per block during initial block download.
+ * A tip is only delivered once both min_interval_ms passed and min_blocks were
+ * connected since the last delivered tip, and newer tips replace a held back
+ * one, so the latest tip is always the one delivered. Tips are delivered right
+ * away if their synchronization state, or whether headers are being presynced,
+ * changes. Once no newer tip arrived for 100 milliseconds, e.g. because
+ * validation went idle, the latest held back tip is delivered from a
+ * background thread as soon as min_interval_ms passed, even if fewer than
+ * min_blocks were connected, so the latest tip is never held back
+ * indefinitely. Held back tips are also delivered before a chainstate manager
+ * is destroyed. Tip callbacks are never called concurrently.
+ *
+ * @param[in] context_options Non-null, previously created by @ref btck_context_options_create.
+ * @param[in] min_interval_ms Minimum number of milliseconds between delivered tips, or 0.
+ * @param[in] min_blocks      Minimum height difference between delivered tips, or 0. Both being 0
+ *                            delivers every tip.
+ * @return                    0 if the set was successful, non-zero if a limit is negative.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_context_options_set_tip_notification_limit(
+    btck_ContextOptions* context_options,
+    int64_t min_interval_ms,
+    int64_t min_blocks) BITCOINKERNEL_ARG_NONNULL(1);
+
 /**
  * @brief Set the validation interface callbacks for the context options. The
  * context created with the options will be configured for these validation
@@ -939,6 +1232,36 @@ BITCOINKERNEL_API void btck_context_options_set_validation_interface(
     btck_ContextOptions* context_options,
     btck_ValidationInterfaceCallbacks validation_interface_callbacks) BITCOINKERNEL_ARG_NONNULL(1);
 
+/**
+ * What happens when a validation interface callback is issued while the
+ * delivery queue is full.
+ */
+typedef uint8_t btck_ValidationQueueOverflow;
+#define btck_ValidationQueueOverflow_BLOCK ((btck_ValidationQueueOverflow)(0))       //!< Validation waits for the queue to drain.
+#define btck_ValidationQueueOverflow_DROP_OLDEST ((btck_ValidationQueueOverflow)(1)) //!< The oldest undelivered callback is dropped.
+
+/**
+ * @brief Deliver the validation interface callbacks on a background thread
+ * through a queue, instead of synchronously on the validating thread, so that
+ * slow callbacks do not stall validation. Callbacks are still delivered one at
+ * a time and in order. With btck_ValidationQueueOverflow_BLOCK, validation waits
+ * for the queue to drain before connecting more blocks once it holds capacity
+ * callbacks. It never waits while holding the validation lock, so callbacks may
+ * use the chainstate manager. With btck_ValidationQueueOverflow_DROP_OLDEST,
+ * validation never waits. The block validation state passed to block_checked
+ * is a copy that is only valid for the duration of the callback.
+ *
+ * @param[in] context_options Non-null, previously created with btck_context_options_create.
+ * @param[in] capacity        Number of validation events the queue holds, at least 1. This includes events
+ *                            without a registered callback, such as tip updates.
+ * @param[in] overflow        What to do once the queue is full.
+ * @return                    0 if the set was successful, non-zero if the capacity is 0.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_context_options_set_validation_interface_queue(
+    btck_ContextOptions* context_options,
+    size_t capacity,
+    btck_ValidationQueueOverflow overflow) BITCOINKERNEL_ARG_NONNULL(1);
+
 /**
  * Destroy the context options.
  */
@@ -984,6 +1307,17 @@ BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_context_interrupt(
  */
 BITCOINKERNEL_API void btck_context_destroy(btck_Context* context);
 
+/**
+ * @brief Wait until all queued validation interface callbacks were delivered,
+ * see @ref btck_context_options_set_validation_interface_queue. Returns right
+ * away if callbacks are delivered synchronously. Must not be called from a
+ * validation interface callback.
+ *
+ * @param[in] context Non-null.
+ */
+BITCOINKERNEL_API void btck_context_sync_validation_interface_queue(
+    const btck_Context* context) BITCOINKERNEL_ARG_NONNULL(1);
+
 ///@}
 
 /** @name BlockTreeEntry
@@ -1050,6 +1384,27 @@ BITCOINKERNEL_API const btck_BlockTreeEntry* BITCOINKERNEL_WARN_UNUSED_RESULT bt
     const btck_BlockTreeEntry* block_tree_entry,
     int32_t height) BITCOINKERNEL_ARG_NONNULL(1);
 
+/**
+ * @brief Check whether the full block of a block tree entry is stored on disk.
+ * The block may not have been received yet, or may have been pruned.
+ *
+ * @param[in] block_tree_entry Non-null.
+ * @return                     1 if the block data is available, 0 otherwise.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_tree_entry_has_data(
+    const btck_BlockTreeEntry* block_tree_entry) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Check whether the spent outputs (undo data) of a block tree entry are
+ * stored on disk. They are only written once the block has been connected,
+ * and never for the genesis block.
+ *
+ * @param[in] block_tree_entry Non-null.
+ * @return                     1 if the undo data is available, 0 otherwise.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_tree_entry_has_undo(
+    const btck_BlockTreeEntry* block_tree_entry) BITCOINKERNEL_ARG_NONNULL(1);
+
 ///@}
 
 /** @name ChainstateManagerOptions
@@ -1088,6 +1443,87 @@ BITCOINKERNEL_API void btck_chainstate_manager_options_set_worker_threads_num(
     btck_ChainstateManagerOptions* chainstate_manager_options,
     int worker_threads) BITCOINKERNEL_ARG_NONNULL(1);
 
+/**
+ * @brief Set the total cache budget of the chainstate manager. The budget is
+ * split between the block tree database, the coins database and the
+ * in-memory coins cache the same way Bitcoin Core splits its -dbcache
+ * setting. Defaults to 450 MiB if not set.
+ *
+ * @param[in] chainstate_manager_options Non-null, options to be set.
+ * @param[in] total_cache_bytes          The total number of bytes to be used for caching.
+ */
+BITCOINKERNEL_API void btck_chainstate_manager_options_set_total_cache_size(
+    btck_ChainstateManagerOptions* chainstate_manager_options,
+    size_t total_cache_bytes) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Set the size of each of the chainstate manager's caches
+ * individually. A larger coins cache reduces how often the coins are flushed
+ * to the coins database during validation.
+ *
+ * @param[in] chainstate_manager_options Non-null, options to be set.
+ * @param[in] block_tree_db_cache_bytes  Number of bytes used by the block tree database cache.
+ * @param[in] coins_db_cache_bytes       Number of bytes used by the coins database cache.
+ * @param[in] coins_cache_bytes          Number of bytes used by the in-memory coins cache.
+ */
+BITCOINKERNEL_API void btck_chainstate_manager_options_set_cache_sizes(
+    btck_ChainstateManagerOptions* chainstate_manager_options,
+    size_t block_tree_db_cache_bytes,
+    size_t coins_db_cache_bytes,
+    size_t coins_cache_bytes) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Override the assumed valid block of the chain parameters. Scripts of
+ * the block and its ancestors are not verified, as long as it is in the best
+ * header chain and buried under enough work. Mostly useful for speeding up
+ * importing test chains, which have no assumed valid block by default.
+ *
+ * @param[in] chainstate_manager_options Non-null, options to be set.
+ * @param[in] block_hash                 Non-null, hash of the block assumed to have valid scripts.
+ */
+BITCOINKERNEL_API void btck_chainstate_manager_options_set_assumed_valid(
+    btck_ChainstateManagerOptions* chainstate_manager_options,
+    const btck_BlockHash* block_hash) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Override the minimum chain work of the chain parameters, the work
+ * the best chain is assumed to have at least. Until the best chain has that
+ * much work, the chainstate manager stays in initial block download.
+ *
+ * @param[in] chainstate_manager_options Non-null, options to be set.
+ * @param[in] minimum_chain_work         Non-null, 32 byte little-endian chain work.
+ */
+BITCOINKERNEL_API void btck_chainstate_manager_options_set_minimum_chain_work(
+    btck_ChainstateManagerOptions* chainstate_manager_options,
+    const unsigned char minimum_chain_work[32]) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Enable pruning of old block and undo files. With a target size, the
+ * oldest block files are deleted whenever the block files grow beyond it.
+ * With UINT64_MAX as target, blocks are only pruned on request through
+ * @ref btck_chainstate_manager_prune_to_height. The most recent 288 blocks are
+ * always kept. Pruning is disabled by default.
+ *
+ * @param[in] chainstate_manager_options Non-null, options to be set.
+ * @param[in] prune_target_bytes         Target size of the block files in bytes, at least 550 MiB. 0 disables
+ *                                       pruning, UINT64_MAX only prunes on request.
+ * @return                               0 if the set was successful, non-zero if the target is too small.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_options_set_prune_target(
+    btck_ChainstateManagerOptions* chainstate_manager_options,
+    uint64_t prune_target_bytes) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Use small block files, so that pruning takes effect on short chains.
+ * Only intended for testing.
+ *
+ * @param[in] chainstate_manager_options Non-null, options to be set.
+ * @param[in] fast_prune                 Set fast prune.
+ */
+BITCOINKERNEL_API void btck_chainstate_manager_options_set_fast_prune(
+    btck_ChainstateManagerOptions* chainstate_manager_options,
+    int fast_prune) BITCOINKERNEL_ARG_NONNULL(1);
+
 /**
  * @brief Sets wipe db in the options. In combination with calling
  * @ref btck_chainstate_manager_import_blocks this triggers either a full reindex,
@@ -1123,6 +1559,17 @@ BITCOINKERNEL_API void btck_chainstate_manager_options_update_chainstate_db_in_m
     btck_ChainstateManagerOptions* chainstate_manager_options,
     int chainstate_db_in_memory) BITCOINKERNEL_ARG_NONNULL(1);
 
+/**
+ * @brief Host a mempool in the chainstate manager created with the options,
+ * see @ref btck_chainstate_manager_get_mempool.
+ *
+ * @param[in] chainstate_manager_options Non-null, created by @ref btck_chainstate_manager_options_create.
+ * @param[in] mempool_options            Non-null, copied into the options.
+ */
+BITCOINKERNEL_API void btck_chainstate_manager_options_set_mempool(
+    btck_ChainstateManagerOptions* chainstate_manager_options,
+    const btck_MempoolOptions* mempool_options) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
 /**
  * Destroy the chainstate manager options.
  */
@@ -1169,6 +1616,45 @@ BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_p
     const btck_BlockHeader* header,
     btck_BlockValidationState* block_validation_state) BITCOINKERNEL_ARG_NONNULL(1, 2, 3);
 
+/**
+ * @brief Processes and validates a run of btck_BlockHeader, in order. Each
+ * header must connect to an already known header or to its predecessor in the
+ * array. Processing stops at the first invalid header.
+ *
+ * @param[in] chainstate_manager        Non-null.
+ * @param[in] headers                   Non-null, array of btck_BlockHeader to be validated.
+ * @param[in] headers_len               Length of the headers array.
+ * @param[out] block_validation_state   The result of the validation of the last processed btck_BlockHeader.
+ * @param[out] last_entry               Nullable, will be set to the btck_BlockTreeEntry of the last accepted
+ *                                      header, or null if none was accepted.
+ * @return                              0 if all headers were processed successfully, non-zero on error.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_process_block_headers(
+    btck_ChainstateManager* chainstate_manager,
+    const btck_BlockHeader** headers,
+    size_t headers_len,
+    btck_BlockValidationState* block_validation_state,
+    const btck_BlockTreeEntry** last_entry) BITCOINKERNEL_ARG_NONNULL(1, 2, 4);
+
+/**
+ * @brief Like btck_chainstate_manager_process_block_headers, but takes the
+ * headers as a contiguous run of serialized 80-byte block headers.
+ *
+ * @param[in] chainstate_manager        Non-null.
+ * @param[in] raw_block_headers         Non-null, serialized block headers.
+ * @param[in] raw_block_headers_len     Length of the serialized block headers, a multiple of 80.
+ * @param[out] block_validation_state   The result of the validation of the last processed btck_BlockHeader.
+ * @param[out] last_entry               Nullable, will be set to the btck_BlockTreeEntry of the last accepted
+ *                                      header, or null if none was accepted.
+ * @return                              0 if all headers were processed successfully, non-zero on error.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_process_raw_block_headers(
+    btck_ChainstateManager* chainstate_manager,
+    const void* raw_block_headers,
+    size_t raw_block_headers_len,
+    btck_BlockValidationState* block_validation_state,
+    const btck_BlockTreeEntry** last_entry) BITCOINKERNEL_ARG_NONNULL(1, 2, 4);
+
 /**
  * @brief Triggers the start of a reindex if the wipe options were previously
  * set for the chainstate manager. Can also import an array of existing block
@@ -1185,6 +1671,59 @@ BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_i
     const char** block_file_paths_data, size_t* block_file_paths_lens,
     size_t block_file_paths_data_len) BITCOINKERNEL_ARG_NONNULL(1);
 
+/**
+ * @brief Import blocks from block files through a pipeline. Up to two files
+ * are scanned for blocks at a time, a pool of threads deserializes the blocks
+ * and runs the context-free block checks, and the calling thread validates
+ * and connects them in order. Blocks may appear in any order across the
+ * files. Blocks whose parent is not known yet are read again from their file
+ * once it is; blocks whose parent is never found are skipped. Unlike
+ * @ref btck_chainstate_manager_import_blocks, this does not trigger a reindex.
+ *
+ * @param[in] chainstate_manager        Non-null.
+ * @param[in] block_file_paths_data     Non-null, array of block files described by their full filesystem paths.
+ * @param[in] block_file_paths_lens     Non-null, array containing the lengths of each of the paths.
+ * @param[in] block_file_paths_data_len Length of the block_file_paths_data and block_file_paths_len arrays.
+ * @param[in] threads                   Number of threads deserializing and checking blocks, at least 1.
+ * @param[in] progress                  Nullable, called on the calling thread about once a second and once
+ *                                      the import is done.
+ * @param[in] user_data                 Nullable, passed through to progress.
+ * @return                              0 if the import completed, non-zero on error, or if it was
+ *                                      interrupted.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_import_blocks_parallel(
+    btck_ChainstateManager* chainstate_manager,
+    const char** block_file_paths_data, size_t* block_file_paths_lens,
+    size_t block_file_paths_data_len,
+    int threads,
+    btck_ImportProgress progress,
+    void* user_data) BITCOINKERNEL_ARG_NONNULL(1, 2, 3);
+
+/**
+ * @brief Import blocks from a stream of block file data, such as the
+ * concatenated contents of block files, through the same pipeline as
+ * @ref btck_chainstate_manager_import_blocks_parallel. The stream is read on a
+ * separate thread. Blocks whose parent is not known yet are held in memory,
+ * up to a total serialized size of 256 MiB; if blocks do not fit the import
+ * fails.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] read               Non-null, called repeatedly to read the stream until it returns 0.
+ * @param[in] threads            Number of threads deserializing and checking blocks, at least 1.
+ * @param[in] progress           Nullable, called on the calling thread about once a second and once
+ *                               the import is done.
+ * @param[in] user_data          Nullable, passed through to read and progress.
+ * @return                       0 if the import completed, non-zero on a read error, other errors, if
+ *                               blocks did not fit in memory while waiting for their parent, or if it
+ *                               was interrupted.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_import_blocks_from_stream(
+    btck_ChainstateManager* chainstate_manager,
+    btck_ReadBytes read,
+    int threads,
+    btck_ImportProgress progress,
+    void* user_data) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
 /**
  * @brief Process and validate the passed in block with the chainstate
  * manager. Processing first does checks on the block, and if these passed,
@@ -1207,6 +1746,30 @@ BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_p
     const btck_Block* block,
     int* new_block) BITCOINKERNEL_ARG_NONNULL(1, 2, 3);
 
+/**
+ * @brief Queue a block for processing, like @ref btck_chainstate_manager_process_block,
+ * on a worker thread owned by the chainstate manager. Submitted blocks are
+ * processed one at a time in submission order, so the caller can receive the
+ * next block while the previous ones are validated. Blocks still queued when
+ * the chainstate manager is destroyed are processed before it is. Blocks
+ * submitted once its destruction started, for example from done while the
+ * queue is drained, are rejected. The chainstate manager must not be destroyed
+ * from done, which aborts the process.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] block              Non-null, block to be validated. It is copied and may be destroyed
+ *                               right away.
+ * @param[in] done               Nullable, called on the worker thread once the block was processed.
+ * @param[in] user_data          Nullable, passed through to done.
+ * @return                       0 if the block was queued, non-zero on error or if the chainstate manager is
+ *                               being destroyed.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_submit_block(
+    btck_ChainstateManager* chainstate_manager,
+    const btck_Block* block,
+    btck_BlockProcessed done,
+    void* user_data) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
 /**
  * @brief Returns the best known currently active chain. Its lifetime is
  * dependent on the chainstate manager. It can be thought of as a view on a
@@ -1224,6 +1787,103 @@ BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_p
 BITCOINKERNEL_API const btck_Chain* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_get_active_chain(
     const btck_ChainstateManager* chainstate_manager) BITCOINKERNEL_ARG_NONNULL(1);
 
+/**
+ * @brief Returns the mempool hosted by the chainstate manager. Its lifetime is
+ * dependent on the chainstate manager.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @return                       The mempool, or null if the chainstate manager was created without
+ *                               @ref btck_chainstate_manager_options_set_mempool.
+ */
+BITCOINKERNEL_API btck_Mempool* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_get_mempool(
+    btck_ChainstateManager* chainstate_manager) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Load an assumeutxo UTXO snapshot, as written by the `dumptxoutset`
+ * RPC, and make a chainstate built from it the active chainstate. The
+ * snapshot's base block must be one of the assumeutxo heights of the chain
+ * parameters, and its header must already have been processed. Progress of
+ * loading the coins is reported through the `progress` notification, which
+ * reports 100 percent with an empty title once the snapshot was validated and
+ * activated, and 0 percent with an empty title if loading it fails.
+ *
+ * The chainstate that was active before keeps validating blocks up to the
+ * snapshot's base block in the background, see
+ * @ref btck_chainstate_manager_get_background_chain.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] path               Non-null, filesystem path to the snapshot file.
+ * @param[in] path_len           Length of the path.
+ * @return                       The block tree entry of the snapshot's base block, or null if the
+ *                               snapshot could not be loaded.
+ */
+BITCOINKERNEL_API const btck_BlockTreeEntry* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_activate_snapshot(
+    btck_ChainstateManager* chainstate_manager,
+    const char* path,
+    size_t path_len) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Delete the block and undo files that only hold blocks up to the given
+ * height. Requires pruning to have been enabled with
+ * @ref btck_chainstate_manager_options_set_prune_target. Blocks within 288
+ * blocks of the tip are kept, even if they are below the height.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] height             Height of the last block that may be pruned, must be positive.
+ * @return                       0 if pruning was successful, non-zero on error.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_prune_to_height(
+    btck_ChainstateManager* chainstate_manager,
+    int32_t height) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Write the UTXO set of the active chainstate to a snapshot file that
+ * can be loaded with @ref btck_chainstate_manager_activate_snapshot. The
+ * coins cache is flushed to the chainstate database first, and the coins are
+ * then streamed from a snapshot of the database, so memory use does not grow
+ * with the size of the UTXO set. The file is written to a temporary path next
+ * to the given one and only moved into place once complete. Writing stops
+ * early if the context is interrupted through @ref btck_context_interrupt,
+ * and fails if the chainstate database is closed in the meantime, see
+ * @ref btck_coins_cursor_create.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] path               Non-null, filesystem path to write the snapshot file to.
+ * @param[in] path_len           Length of the path.
+ * @param[out] coins_written     Nullable, will be set to the number of coins written.
+ * @return                       The block tree entry of the snapshot's base block, or null if the
+ *                               snapshot could not be written.
+ */
+BITCOINKERNEL_API const btck_BlockTreeEntry* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_dump_snapshot(
+    btck_ChainstateManager* chainstate_manager,
+    const char* path,
+    size_t path_len,
+    uint64_t* coins_written) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Returns the chain of the chainstate validating blocks in the
+ * background up to the base block of a loaded snapshot. Its lifetime is
+ * dependent on the chainstate manager. Comparing its height to the height of
+ * the entry returned by @ref btck_chainstate_manager_get_background_target
+ * gives the progress of background validation.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @return                       The background chain, or null if no snapshot is being validated.
+ */
+BITCOINKERNEL_API const btck_Chain* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_get_background_chain(
+    const btck_ChainstateManager* chainstate_manager) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Returns the block the background chainstate is validating up to,
+ * which is the base block of the loaded snapshot.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @return                       The block tree entry of the target, or null if no snapshot is being
+ *                               validated.
+ */
+BITCOINKERNEL_API const btck_BlockTreeEntry* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_get_background_target(
+    const btck_ChainstateManager* chainstate_manager) BITCOINKERNEL_ARG_NONNULL(1);
+
 /**
  * @brief Retrieve a block tree entry by its block hash.
  *
@@ -1236,6 +1896,41 @@ BITCOINKERNEL_API const btck_BlockTreeEntry* BITCOINKERNEL_WARN_UNUSED_RESULT bt
     const btck_ChainstateManager* chainstate_manager,
     const btck_BlockHash* block_hash) BITCOINKERNEL_ARG_NONNULL(1, 2);
 
+/**
+ * @brief Look up an unspent transaction output in the UTXO set of the active
+ * chainstate. Lookups go through the in-memory coins cache before falling back
+ * to the chainstate database. Coins read from the database are not added to
+ * the cache, so that lookups do not cause it to be flushed more often.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] out_point          Non-null, the out point of the output to look up.
+ * @return                       The coin, or null if the output is not in the UTXO set or on error.
+ */
+BITCOINKERNEL_API btck_Coin* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_get_coin(
+    const btck_ChainstateManager* chainstate_manager,
+    const btck_TransactionOutPoint* out_point) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Look up a batch of unspent transaction outputs in the UTXO set of
+ * the active chainstate. All lookups are done under a single acquisition of
+ * the validation lock, which makes this considerably cheaper than repeated
+ * calls to @ref btck_chainstate_manager_get_coin for large batches.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] out_points         Non-null, array of out points to look up.
+ * @param[in] out_points_len     Length of the out_points and coins arrays.
+ * @param[out] coins             Non-null, array that will be populated with the coin for the out point at
+ *                               the same position, or null if that output is not in the UTXO set. The
+ *                               returned coins are owned by the caller.
+ * @return                       0 if all lookups completed successfully, non-zero on error. On error, no
+ *                               coins are returned.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_get_coins(
+    const btck_ChainstateManager* chainstate_manager,
+    const btck_TransactionOutPoint** out_points,
+    size_t out_points_len,
+    btck_Coin** coins) BITCOINKERNEL_ARG_NONNULL(1, 2, 4);
+
 /**
  * Destroy the chainstate manager.
  */
@@ -1260,6 +1955,48 @@ BITCOINKERNEL_API btck_Block* BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_read(
     const btck_ChainstateManager* chainstate_manager,
     const btck_BlockTreeEntry* block_tree_entry) BITCOINKERNEL_ARG_NONNULL(1, 2);
 
+/**
+ * @brief Reads the block the passed in block tree entry points to together
+ * with its spent outputs from disk. Cheaper than reading them separately, since
+ * their positions on disk are looked up together. The spent outputs of the
+ * genesis block are empty, the same as for @ref btck_block_spent_outputs_read.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] block_tree_entry   Non-null.
+ * @param[out] block             Non-null, will be set to the read out block, owned by the caller.
+ * @param[out] spent_outputs     Non-null, will be set to the read out block spent outputs, owned by the
+ *                               caller.
+ * @return                       0 on success, non-zero if either could not be read.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_read_with_spent_outputs(
+    const btck_ChainstateManager* chainstate_manager,
+    const btck_BlockTreeEntry* block_tree_entry,
+    btck_Block** block,
+    btck_BlockSpentOutputs** spent_outputs) BITCOINKERNEL_ARG_NONNULL(1, 2, 3, 4);
+
+/**
+ * @brief Reads the serialized block the passed in block tree entry points to
+ * from disk, without deserializing it. Optionally only reads a byte range of
+ * the block.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] block_tree_entry   Non-null.
+ * @param[in] offset             Offset of the byte range to read, must be 0 if len is 0.
+ * @param[in] len                Length of the byte range to read, or 0 to read the whole block.
+ * @param[in] writer             Non-null, callback to a write bytes function.
+ * @param[in] user_data          Holds a user-defined opaque structure that will be
+ *                               passed back through the writer callback.
+ * @return                       0 on success, non-zero if the block could not be read
+ *                               or the byte range is out of bounds.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_read_raw(
+    const btck_ChainstateManager* chainstate_manager,
+    const btck_BlockTreeEntry* block_tree_entry,
+    size_t offset,
+    size_t len,
+    btck_WriteBytes writer,
+    void* user_data) BITCOINKERNEL_ARG_NONNULL(1, 2, 5);
+
 /**
  * @brief Parse a serialized raw block into a new block object.
  *
@@ -1369,6 +2106,29 @@ BITCOINKERNEL_API int btck_block_to_bytes(
     btck_WriteBytes writer,
     void* user_data) BITCOINKERNEL_ARG_NONNULL(1, 2);
 
+/**
+ * @brief Get the size of the consensus serialization of the block.
+ *
+ * @param[in] block Non-null.
+ * @return          The serialized size in bytes.
+ */
+BITCOINKERNEL_API size_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_serialized_size(
+    const btck_Block* block) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Serializes the block into the passed in buffer. This is the same
+ * serialization as btck_block_to_bytes, written in a single pass.
+ *
+ * @param[in] block      Non-null.
+ * @param[out] buffer    Non-null, buffer the serialized block is written to.
+ * @param[in] buffer_len Length of the buffer, must be at least btck_block_serialized_size.
+ * @return               0 on success, non-zero if the buffer is too small.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_to_buffer(
+    const btck_Block* block,
+    void* buffer,
+    size_t buffer_len) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
 /**
  * Destroy the block.
  */
@@ -1376,6 +2136,67 @@ BITCOINKERNEL_API void btck_block_destroy(btck_Block* block);
 
 ///@}
 
+/** @name BlockColumns
+ * Functions for exporting the contents of a block as arrays.
+ */
+///@{
+
+/**
+ * The arrays a block is flattened into. Per transaction arrays are indexed by
+ * the position of the transaction in the block, and input and output arrays by
+ * the position of the input or output across all transactions of the block.
+ * Offset arrays have one more element than the arrays they index into, so that
+ * element i + 1 is the end of range i. Spent output arrays are indexed like the
+ * inputs. The coinbase input does not spend an output, and its entries are zero.
+ */
+typedef uint8_t btck_BlockColumn;
+#define btck_BlockColumn_TX_INPUT_OFFSETS ((btck_BlockColumn)(0))       //!< uint32_t per transaction, index of its first input.
+#define btck_BlockColumn_TX_OUTPUT_OFFSETS ((btck_BlockColumn)(1))      //!< uint32_t per transaction, index of its first output.
+#define btck_BlockColumn_TXIDS ((btck_BlockColumn)(2))                  //!< 32 bytes per transaction.
+#define btck_BlockColumn_INPUT_PREVOUT_TXIDS ((btck_BlockColumn)(3))    //!< 32 bytes per input.
+#define btck_BlockColumn_INPUT_PREVOUT_INDICES ((btck_BlockColumn)(4))  //!< uint32_t per input.
+#define btck_BlockColumn_OUTPUT_AMOUNTS ((btck_BlockColumn)(5))         //!< int64_t per output.
+#define btck_BlockColumn_OUTPUT_SCRIPT_OFFSETS ((btck_BlockColumn)(6))  //!< uint32_t per output, offset of its script pubkey.
+#define btck_BlockColumn_OUTPUT_SCRIPTS ((btck_BlockColumn)(7))         //!< Bytes of all output script pubkeys.
+#define btck_BlockColumn_SPENT_AMOUNTS ((btck_BlockColumn)(8))          //!< int64_t per input.
+#define btck_BlockColumn_SPENT_HEIGHTS ((btck_BlockColumn)(9))          //!< uint32_t per input, confirmation height.
+#define btck_BlockColumn_SPENT_IS_COINBASE ((btck_BlockColumn)(10))     //!< uint8_t per input.
+#define btck_BlockColumn_SPENT_SCRIPT_OFFSETS ((btck_BlockColumn)(11))  //!< uint32_t per input, offset of its script pubkey.
+#define btck_BlockColumn_SPENT_SCRIPTS ((btck_BlockColumn)(12))         //!< Bytes of all spent script pubkeys.
+
+/**
+ * @brief Flatten a block, and optionally its spent outputs, into arrays in a
+ * single pass.
+ *
+ * @param[in] block         Non-null.
+ * @param[in] spent_outputs Nullable, the spent outputs of the block. The spent output arrays are empty if null.
+ * @return                  The block columns, or null if the spent outputs do not match the block.
+ */
+BITCOINKERNEL_API btck_BlockColumns* BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_columns_create(
+    const btck_Block* block,
+    const btck_BlockSpentOutputs* spent_outputs) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Get one of the arrays of the block columns. The array is valid for
+ * the lifetime of the block columns.
+ *
+ * @param[in] block_columns Non-null.
+ * @param[in] column        The array to get.
+ * @param[out] len          Non-null, will be set to the number of elements in the array.
+ * @return                  Pointer to the first element of the array, or null if it is empty.
+ */
+BITCOINKERNEL_API const void* btck_block_columns_get(
+    const btck_BlockColumns* block_columns,
+    btck_BlockColumn column,
+    size_t* len) BITCOINKERNEL_ARG_NONNULL(1, 3);
+
+/**
+ * Destroy the block columns.
+ */
+BITCOINKERNEL_API void btck_block_columns_destroy(btck_BlockColumns* block_columns);
+
+///@}
+
 /** @name BlockValidationState
  * Functions for working with block validation states.
  */
@@ -1415,6 +2236,165 @@ BITCOINKERNEL_API void btck_block_validation_state_destroy(
 
 ///@}
 
+/** @name MempoolOptions
+ * Functions for working with mempool options.
+ */
+///@{
+
+/**
+ * @brief Create mempool options with the same defaults as Bitcoin Core.
+ */
+BITCOINKERNEL_API btck_MempoolOptions* BITCOINKERNEL_WARN_UNUSED_RESULT btck_mempool_options_create();
+
+/**
+ * @brief Sets the maximum memory usage of the mempool. Once it is exceeded,
+ * the transactions with the lowest fee rate are evicted, and the minimum fee
+ * rate for accepting new transactions rises.
+ *
+ * @param[in] mempool_options Non-null.
+ * @param[in] max_size_bytes  Maximum memory usage in bytes. Must be large enough to hold a cluster
+ *                            of the maximum cluster size, otherwise creating the chainstate manager fails.
+ * @return                    0 if the set was successful, non-zero if the size is negative.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_mempool_options_set_max_size(
+    btck_MempoolOptions* mempool_options,
+    int64_t max_size_bytes) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Sets how long transactions are kept in the mempool before they expire.
+ *
+ * @param[in] mempool_options Non-null.
+ * @param[in] expiry_seconds  Number of seconds after which unconfirmed transactions are removed.
+ * @return                    0 if the set was successful, non-zero if the expiry is negative.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_mempool_options_set_expiry(
+    btck_MempoolOptions* mempool_options,
+    int64_t expiry_seconds) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Sets the package limits transactions must stay within to be accepted.
+ *
+ * @param[in] mempool_options     Non-null.
+ * @param[in] cluster_count       Maximum number of transactions in a cluster.
+ * @param[in] cluster_size_vbytes Maximum size of a cluster in virtual bytes.
+ * @param[in] ancestor_count      Maximum number of transactions in a package of a transaction and its ancestors.
+ * @param[in] descendant_count    Maximum number of transactions in a package of a transaction and its descendants.
+ * @return                        0 if the set was successful, non-zero if a limit is not positive.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_mempool_options_set_limits(
+    btck_MempoolOptions* mempool_options,
+    uint32_t cluster_count,
+    int64_t cluster_size_vbytes,
+    int64_t ancestor_count,
+    int64_t descendant_count) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Sets whether transactions must be standard to be accepted. Only
+ * test chains accept non-standard transactions.
+ *
+ * @param[in] mempool_options  Non-null.
+ * @param[in] require_standard Whether non-standard transactions are rejected.
+ */
+BITCOINKERNEL_API void btck_mempool_options_set_require_standard(
+    btck_MempoolOptions* mempool_options,
+    int require_standard) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * Destroy the mempool options.
+ */
+BITCOINKERNEL_API void btck_mempool_options_destroy(btck_MempoolOptions* mempool_options);
+
+///@}
+
+/** @name Mempool
+ * Functions for working with the mempool.
+ */
+///@{
+
+/** Result of submitting a transaction to the mempool. */
+typedef uint8_t btck_MempoolAcceptResult;
+#define btck_MempoolAcceptResult_VALID ((btck_MempoolAcceptResult)(0))             //!< Valid, and accepted unless only tested.
+#define btck_MempoolAcceptResult_INVALID ((btck_MempoolAcceptResult)(1))           //!< Invalid.
+#define btck_MempoolAcceptResult_MEMPOOL_ENTRY ((btck_MempoolAcceptResult)(2))     //!< Already in the mempool.
+#define btck_MempoolAcceptResult_DIFFERENT_WITNESS ((btck_MempoolAcceptResult)(3)) //!< Not validated, a transaction with the same txid and a different witness is in the mempool.
+#define btck_MempoolAcceptResult_UNFINISHED ((btck_MempoolAcceptResult)(4))        //!< Not validated, because validating the package failed before.
+
+/**
+ * @brief Validates a transaction against the active chainstate and the
+ * mempool policy, and adds it to the mempool if it is valid. Adding it may
+ * evict other transactions to stay within the mempool's maximum size.
+ *
+ * @param[in] mempool       Non-null.
+ * @param[in] transaction   Non-null.
+ * @param[in] test_accept   If 1, the transaction is only validated and not added.
+ * @param[in] reject_reason Nullable, receives the reason if the transaction is invalid.
+ * @param[in] user_data     Passed back through the reject_reason callback.
+ * @return                  The result of validating the transaction.
+ */
+BITCOINKERNEL_API btck_MempoolAcceptResult btck_mempool_accept_transaction(
+    btck_Mempool* mempool,
+    const btck_Transaction* transaction,
+    int test_accept,
+    btck_WriteBytes reject_reason,
+    void* user_data) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Validates a package of transactions together, so that a child can pay
+ * for parents whose fee rate is too low on their own, and adds them to the
+ * mempool if they are valid. Unless only tested, the package must consist of
+ * a child and its unconfirmed parents, sorted topologically.
+ *
+ * @param[in] mempool       Non-null.
+ * @param[in] transactions  Non-null, array of the package's non-null transactions.
+ * @param[in] len           Number of transactions, must be positive.
+ * @param[in] test_accept   If 1, the transactions are only validated and not added.
+ * @param[out] results      Non-null, receives the result for each transaction, in order.
+ * @param[in] reject_reason Nullable, receives the reason if the package is invalid.
+ * @param[in] user_data     Passed back through the reject_reason callback.
+ * @return                  0 if the package is valid, non-zero otherwise, or if it is
+ *                          empty or a transaction is null.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_mempool_accept_package(
+    btck_Mempool* mempool,
+    const btck_Transaction** transactions,
+    size_t len,
+    int test_accept,
+    btck_MempoolAcceptResult* results,
+    btck_WriteBytes reject_reason,
+    void* user_data) BITCOINKERNEL_ARG_NONNULL(1, 2, 5);
+
+/**
+ * @brief Returns the number of transactions in the mempool.
+ *
+ * @param[in] mempool Non-null.
+ * @return            The number of transactions.
+ */
+BITCOINKERNEL_API size_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_mempool_count_transactions(
+    const btck_Mempool* mempool) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Returns the memory usage of the mempool, which is bounded by its
+ * maximum size.
+ *
+ * @param[in] mempool Non-null.
+ * @return            The memory usage in bytes.
+ */
+BITCOINKERNEL_API size_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_mempool_get_usage(
+    const btck_Mempool* mempool) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Returns whether a transaction is in the mempool.
+ *
+ * @param[in] mempool Non-null.
+ * @param[in] txid    Non-null.
+ * @return            1 if the transaction is in the mempool, 0 otherwise.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_mempool_contains(
+    const btck_Mempool* mempool,
+    const btck_Txid* txid) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+///@}
+
 /** @name Chain
  * Functions for working with the chain
  */
@@ -1456,6 +2436,78 @@ BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chain_contains(
 
 ///@}
 
+/** @name ChainSnapshot
+ * Functions for working with chain snapshots.
+ */
+///@{
+
+/**
+ * @brief Create a snapshot of the chain in its current state. The snapshot
+ * remains valid for the lifetime of the chainstate manager the chain was
+ * retrieved from.
+ *
+ * @param[in] chain Non-null.
+ * @return          The chain snapshot, or null on error.
+ */
+BITCOINKERNEL_API btck_ChainSnapshot* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chain_snapshot_create(
+    const btck_Chain* chain) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Return the height of the tip of the chain snapshot.
+ *
+ * @param[in] chain_snapshot Non-null.
+ * @return                   The height of the tip, or -1 if the chain was empty.
+ */
+BITCOINKERNEL_API int32_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_chain_snapshot_get_height(
+    const btck_ChainSnapshot* chain_snapshot) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Retrieve a block tree entry by its height in the chain snapshot.
+ *
+ * @param[in] chain_snapshot Non-null.
+ * @param[in] block_height   Height in the chain of the to be retrieved block tree entry.
+ * @return                   The block tree entry at a certain height in the chain snapshot, or null if the
+ *                           height is out of bounds.
+ */
+BITCOINKERNEL_API const btck_BlockTreeEntry* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chain_snapshot_get_by_height(
+    const btck_ChainSnapshot* chain_snapshot,
+    int32_t block_height) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Retrieve the block tree entries of a range of heights in the chain
+ * snapshot. The range is clamped to the heights in the snapshot.
+ *
+ * @param[in] chain_snapshot      Non-null.
+ * @param[in] start_height        Height of the first entry to retrieve.
+ * @param[in] stop_height         Height after the last entry to retrieve.
+ * @param[out] block_tree_entries Non-null, array of length stop_height - start_height that will be populated
+ *                                with the entries.
+ * @return                        The number of entries written to block_tree_entries.
+ */
+BITCOINKERNEL_API size_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_chain_snapshot_get_range(
+    const btck_ChainSnapshot* chain_snapshot,
+    int32_t start_height,
+    int32_t stop_height,
+    const btck_BlockTreeEntry** block_tree_entries) BITCOINKERNEL_ARG_NONNULL(1, 4);
+
+/**
+ * @brief Return true if the chain snapshot contains the block tree entry.
+ *
+ * @param[in] chain_snapshot   Non-null.
+ * @param[in] block_tree_entry Non-null.
+ * @return                     1 if the block_tree_entry is in the chain snapshot, 0 otherwise.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_chain_snapshot_contains(
+    const btck_ChainSnapshot* chain_snapshot,
+    const btck_BlockTreeEntry* block_tree_entry) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * Destroy the chain snapshot.
+ */
+BITCOINKERNEL_API void btck_chain_snapshot_destroy(btck_ChainSnapshot* chain_snapshot);
+
+///@}
+
 /** @name BlockSpentOutputs
  * Functions for working with block spent outputs.
  */
@@ -1602,6 +2654,16 @@ BITCOINKERNEL_API void btck_transaction_input_destroy(btck_TransactionInput* tra
  */
 ///@{
 
+/**
+ * @brief Create a transaction out point referencing an output of a transaction.
+ *
+ * @param[in] txid  Non-null, the txid of the transaction containing the output.
+ * @param[in] index The output position within the transaction.
+ * @return          The transaction out point.
+ */
+BITCOINKERNEL_API btck_TransactionOutPoint* BITCOINKERNEL_WARN_UNUSED_RESULT btck_transaction_out_point_create(
+    const btck_Txid* txid, uint32_t index) BITCOINKERNEL_ARG_NONNULL(1);
+
 /**
  * @brief Copy a transaction out point.
  *
@@ -1642,6 +2704,15 @@ BITCOINKERNEL_API void btck_transaction_out_point_destroy(btck_TransactionOutPoi
  */
 ///@{
 
+/**
+ * @brief Create a txid from its raw data.
+ *
+ * @param[in] txid Non-null, the 32-byte txid in little-endian byte order.
+ * @return         The txid.
+ */
+BITCOINKERNEL_API btck_Txid* BITCOINKERNEL_WARN_UNUSED_RESULT btck_txid_create(
+    const unsigned char txid[32]) BITCOINKERNEL_ARG_NONNULL(1);
+
 /**
  * @brief Copy a txid.
  *
@@ -1727,6 +2798,241 @@ BITCOINKERNEL_API void btck_coin_destroy(btck_Coin* coin);
 
 ///@}
 
+/** @name CoinsCursor
+ * Functions for iterating over the UTXO set.
+ */
+///@{
+
+/**
+ * @brief Create a cursor over the UTXO set of the active chainstate. The coins
+ * cache is flushed to the chainstate database first, and the cursor then
+ * iterates over a snapshot of the database taken at creation, in txid order.
+ *
+ * The txid space is split into shard_count contiguous ranges of roughly equal
+ * size, of which the cursor only visits the one at shard_index. Cursors over
+ * different shards may be used concurrently from different threads to scan
+ * the UTXO set in parallel, but a single cursor must not be. Reading from the
+ * cursor fails once the chainstate database is closed, which happens when the
+ * chainstate manager is destroyed and when the database cache is resized,
+ * e.g. while a snapshot is loaded with
+ * @ref btck_chainstate_manager_activate_snapshot.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] shard_index        Index of the shard to iterate over, must be smaller than shard_count.
+ * @param[in] shard_count        Number of shards to split the txid space into, must be at least 1.
+ * @return                       The coins cursor, or null on error.
+ */
+BITCOINKERNEL_API btck_CoinsCursor* BITCOINKERNEL_WARN_UNUSED_RESULT btck_coins_cursor_create(
+    const btck_ChainstateManager* chainstate_manager,
+    uint32_t shard_index,
+    uint32_t shard_count) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Get the hash of the block the UTXO set snapshot of the cursor
+ * corresponds to.
+ *
+ * @param[in] coins_cursor Non-null.
+ * @return                 The block hash.
+ */
+BITCOINKERNEL_API btck_BlockHash* BITCOINKERNEL_WARN_UNUSED_RESULT btck_coins_cursor_get_best_block_hash(
+    const btck_CoinsCursor* coins_cursor) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Read the next batch of coins from the cursor. A batch only holds
+ * fewer than batch_size coins once the end of the shard is reached.
+ *
+ * @param[in] coins_cursor Non-null.
+ * @param[in] batch_size   Maximum number of coins to read, and length of the out_points and coins arrays.
+ * @param[out] out_points  Non-null, array that will be populated with the out points of the read coins. The
+ *                         returned out points are owned by the caller.
+ * @param[out] coins       Non-null, array that will be populated with the read coins. The returned coins are
+ *                         owned by the caller.
+ * @param[out] batch_len   Non-null, will be set to the number of coins read. Set to 0 once the cursor is
+ *                         exhausted.
+ * @return                 0 if the batch was read successfully, non-zero on error.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_coins_cursor_next_batch(
+    btck_CoinsCursor* coins_cursor,
+    size_t batch_size,
+    btck_TransactionOutPoint** out_points,
+    btck_Coin** coins,
+    size_t* batch_len) BITCOINKERNEL_ARG_NONNULL(1, 3, 4, 5);
+
+/**
+ * Destroy the coins cursor.
+ */
+BITCOINKERNEL_API void btck_coins_cursor_destroy(btck_CoinsCursor* coins_cursor);
+
+///@}
+
+/** @name UtxoStats
+ * Functions for computing statistics about the UTXO set.
+ */
+///@{
+
+/**
+ * The hash to compute over the UTXO set.
+ */
+typedef uint8_t btck_UtxoHashType;
+#define btck_UtxoHashType_HASH_SERIALIZED ((btck_UtxoHashType)(0)) //!< SHA256 of the serialized set, as committed to by assumeutxo snapshots.
+#define btck_UtxoHashType_MUHASH ((btck_UtxoHashType)(1))          //!< MuHash3072 of the set, as used by the coinstats index.
+#define btck_UtxoHashType_NONE ((btck_UtxoHashType)(2))            //!< Do not hash the set.
+
+/**
+ * @brief Compute statistics about the UTXO set of the active chainstate by
+ * scanning the chainstate database. The coins cache is flushed to the
+ * database first, and the statistics correspond to a snapshot of the database
+ * taken at that point.
+ *
+ * The MuHash of the set is the product of the hashes of its coins, so for
+ * btck_UtxoHashType_MUHASH and btck_UtxoHashType_NONE and more than one thread,
+ * the txid space is split into shards that are scanned in parallel. The
+ * serialized hash depends on the order of the coins, so it is always computed
+ * by a single thread. A single thread scans the set the same way as Bitcoin
+ * Core's gettxoutsetinfo does. The scan stops early if the context is
+ * interrupted through @ref btck_context_interrupt, and fails if the chainstate
+ * database is closed in the meantime, see @ref btck_coins_cursor_create.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] hash_type          The hash to compute over the set.
+ * @param[in] threads            Number of threads scanning the set, must be at least 1.
+ * @param[in] progress           Nullable, called periodically with the number of coins scanned so far.
+ *                               May be called from different threads, but never concurrently.
+ * @param[in] user_data          Nullable, passed to the progress callback.
+ * @return                       The UTXO set statistics, or null on error or interruption.
+ */
+BITCOINKERNEL_API btck_UtxoStats* BITCOINKERNEL_WARN_UNUSED_RESULT btck_chainstate_manager_get_utxo_stats(
+    btck_ChainstateManager* chainstate_manager,
+    btck_UtxoHashType hash_type,
+    int threads,
+    btck_UtxoStatsProgress progress,
+    void* user_data) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Get the height of the block the UTXO set statistics correspond to.
+ *
+ * @param[in] utxo_stats Non-null.
+ * @return               The block height.
+ */
+BITCOINKERNEL_API int32_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_utxo_stats_get_height(
+    const btck_UtxoStats* utxo_stats) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Get the hash of the block the UTXO set statistics correspond to.
+ *
+ * @param[in] utxo_stats Non-null.
+ * @return               The block hash.
+ */
+BITCOINKERNEL_API btck_BlockHash* BITCOINKERNEL_WARN_UNUSED_RESULT btck_utxo_stats_get_block_hash(
+    const btck_UtxoStats* utxo_stats) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Get the number of transactions with unspent outputs.
+ *
+ * @param[in] utxo_stats Non-null.
+ * @return               The number of transactions.
+ */
+BITCOINKERNEL_API uint64_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_utxo_stats_get_transaction_count(
+    const btck_UtxoStats* utxo_stats) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Get the number of unspent outputs.
+ *
+ * @param[in] utxo_stats Non-null.
+ * @return               The number of coins.
+ */
+BITCOINKERNEL_API uint64_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_utxo_stats_get_coins_count(
+    const btck_UtxoStats* utxo_stats) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Get the total amount of all unspent outputs.
+ *
+ * @param[in] utxo_stats    Non-null.
+ * @param[out] total_amount Non-null, will be set to the total amount in satoshis.
+ * @return                  0 on success, non-zero if the total amount overflowed.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_utxo_stats_get_total_amount(
+    const btck_UtxoStats* utxo_stats, int64_t* total_amount) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Get the database-independent size metric of the UTXO set.
+ *
+ * @param[in] utxo_stats Non-null.
+ * @return               The bogo size in bytes.
+ */
+BITCOINKERNEL_API uint64_t BITCOINKERNEL_WARN_UNUSED_RESULT btck_utxo_stats_get_bogo_size(
+    const btck_UtxoStats* utxo_stats) BITCOINKERNEL_ARG_NONNULL(1);
+
+/**
+ * @brief Get the hash of the UTXO set. All zeros if it was computed with
+ * btck_UtxoHashType_NONE.
+ *
+ * @param[in] utxo_stats Non-null.
+ * @param[out] output    The hash.
+ */
+BITCOINKERNEL_API void btck_utxo_stats_get_hash(
+    const btck_UtxoStats* utxo_stats, unsigned char output[32]) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * Destroy the UTXO set statistics.
+ */
+BITCOINKERNEL_API void btck_utxo_stats_destroy(btck_UtxoStats* utxo_stats);
+
+///@}
+
+/** @name BlockRangeReader
+ * Functions for reading sequences of blocks from disk.
+ */
+///@{
+
+/**
+ * @brief Create a reader for the blocks the passed in block tree entries point
+ * to. The blocks are read from disk on worker threads, at most prefetch blocks
+ * ahead of the block last returned by btck_block_range_reader_next. If the
+ * chainstate manager is destroyed first, its worker threads are stopped and
+ * getting further blocks from the reader fails.
+ *
+ * @param[in] chainstate_manager Non-null.
+ * @param[in] block_tree_entries Non-null, array of the entries of the blocks to read, in the order they
+ *                               should be returned.
+ * @param[in] entries_len        Length of the block_tree_entries array.
+ * @param[in] with_spent_outputs If non-zero, the spent outputs of each block are read together with it.
+ * @param[in] prefetch           Maximum number of blocks to read ahead, must be at least 1.
+ * @param[in] worker_threads     Number of threads reading blocks, clamped to at least 1 and at most prefetch.
+ * @return                       The block range reader, or null on error.
+ */
+BITCOINKERNEL_API btck_BlockRangeReader* BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_range_reader_create(
+    const btck_ChainstateManager* chainstate_manager,
+    const btck_BlockTreeEntry** block_tree_entries,
+    size_t entries_len,
+    int with_spent_outputs,
+    size_t prefetch,
+    int worker_threads) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Get the next block from the reader, waiting for it to be read if
+ * necessary. Must not be called concurrently on the same reader.
+ *
+ * @param[in] block_range_reader Non-null.
+ * @param[out] block             Non-null, will be set to the next block, owned by the caller, or to null once
+ *                               the reader is exhausted.
+ * @param[out] spent_outputs     Nullable, will be set to the spent outputs of the block, owned by the caller, if
+ *                               the reader was created to read them, or to null otherwise.
+ * @return                       0 on success, non-zero if the block could not be read or the chainstate
+ *                               manager was destroyed.
+ */
+BITCOINKERNEL_API int BITCOINKERNEL_WARN_UNUSED_RESULT btck_block_range_reader_next(
+    btck_BlockRangeReader* block_range_reader,
+    btck_Block** block,
+    btck_BlockSpentOutputs** spent_outputs) BITCOINKERNEL_ARG_NONNULL(1, 2);
+
+/**
+ * Destroy the block range reader, joining its worker threads.
+ */
+BITCOINKERNEL_API void btck_block_range_reader_destroy(btck_BlockRangeReader* block_range_reader);
+
+///@}
+
 /** @name BlockHash
  * Functions for working with block hashes.
  */
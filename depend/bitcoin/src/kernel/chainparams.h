@@ -124,6 +124,9 @@ public:
     {
         return FindFirst(m_assumeutxo_data, [&](const auto& d) { return d.blockhash == blockhash; });
     }
+    //! Allow loading a snapshot that is not part of the built-in parameters,
+    //! e.g. of a test chain.
+    void AddAssumeutxoData(const AssumeutxoData& data) { m_assumeutxo_data.push_back(data); }
 
     const ChainTxData& TxData() const { return chainTxData; }
 
@@ -703,7 +703,11 @@ CBlockFileInfo* BlockManager::GetBlockFileInfo(size_t n)
 bool BlockManager::ReadBlockUndo(CBlockUndo& blockundo, const CBlockIndex& index) const
 {
     const FlatFilePos pos{WITH_LOCK(::cs_main, return index.GetUndoPos())};
+    return ReadBlockUndo(blockundo, pos, index.pprev->GetBlockHash());
+}
 
+bool BlockManager::ReadBlockUndo(CBlockUndo& blockundo, const FlatFilePos& pos, const uint256& prev_block_hash) const
+{
     // Open history file to read
     AutoFile file{OpenUndoFile(pos, true)};
     if (file.IsNull()) {
@@ -716,7 +720,7 @@ bool BlockManager::ReadBlockUndo(CBlockUndo& blockundo, const CBlockIndex& index
         // Read block
         HashVerifier verifier{filein}; // Use HashVerifier, as reserializing may lose data, c.f. commit d3424243
 
-        verifier << index.pprev->GetBlockHash();
+        verifier << prev_block_hash;
         verifier >> blockundo;
 
         uint256 hashChecksum;
@@ -477,6 +477,7 @@ public:
     ReadRawBlockResult ReadRawBlock(const FlatFilePos& pos, std::optional<std::pair<size_t, size_t>> block_part = std::nullopt) const;
 
     bool ReadBlockUndo(CBlockUndo& blockundo, const CBlockIndex& index) const;
+    bool ReadBlockUndo(CBlockUndo& blockundo, const FlatFilePos& pos, const uint256& prev_block_hash) const;
 
     void CleanupBlockRevFiles() const;
 };
@@ -56,6 +56,11 @@ CCoinsViewDB::CCoinsViewDB(DBParams db_params, CoinsViewOptions options) :
     m_options{std::move(options)},
     m_db{std::make_unique<CDBWrapper>(m_db_params)} { }
 
+CCoinsViewDB::~CCoinsViewDB()
+{
+    if (m_before_close) m_before_close();
+}
+
 void CCoinsViewDB::ResizeCache(size_t new_cache_size)
 {
     // We can't do this operation with an in-memory DB since we'll lose all the coins upon
@@ -63,6 +68,7 @@ void CCoinsViewDB::ResizeCache(size_t new_cache_size)
     if (!m_db_params.memory_only) {
         // Have to do a reset first to get the original `m_db` state to release its
         // filesystem lock.
+        if (m_before_close) m_before_close();
         m_db.reset();
         m_db_params.cache_bytes = new_cache_size;
         m_db_params.wipe_data = false;
@@ -199,13 +205,18 @@ private:
 };
 
 std::unique_ptr<CCoinsViewCursor> CCoinsViewDB::Cursor() const
+{
+    return Cursor(Txid{});
+}
+
+std::unique_ptr<CCoinsViewCursor> CCoinsViewDB::Cursor(const Txid& start) const
 {
     auto i = std::make_unique<CCoinsViewDBCursor>(
         const_cast<CDBWrapper&>(*m_db).NewIterator(), GetBestBlock());
     /* It seems that there are no "const iterators" for LevelDB.  Since we
        only need read operations on it, use a const-cast to get around
        that restriction.  */
-    i->pcursor->Seek(DB_COIN);
+    i->pcursor->Seek(std::make_pair(DB_COIN, start));
     // Cache key of first record
     if (i->pcursor->Valid()) {
         CoinEntry entry(&i->keyTmp.second);
@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -37,8 +38,10 @@ protected:
     DBParams m_db_params;
     CoinsViewOptions m_options;
     std::unique_ptr<CDBWrapper> m_db;
+    std::function<void()> m_before_close;
 public:
     explicit CCoinsViewDB(DBParams db_params, CoinsViewOptions options);
+    ~CCoinsViewDB() override;
 
     std::optional<Coin> GetCoin(const COutPoint& outpoint) const override;
     std::optional<Coin> PeekCoin(const COutPoint& outpoint) const override;
@@ -47,6 +50,8 @@ public:
     std::vector<uint256> GetHeadBlocks() const override;
     void BatchWrite(CoinsViewCacheCursor& cursor, const uint256& block_hash) override;
     std::unique_ptr<CCoinsViewCursor> Cursor() const override;
+    //! Cursor positioned at the first coin whose txid is not less than start.
+    std::unique_ptr<CCoinsViewCursor> Cursor(const Txid& start) const;
 
     //! Whether an unsupported database format is used.
     bool NeedsUpgrade();
@@ -54,6 +59,11 @@ public:
 
     //! Dynamically alter the underlying leveldb cache size.
     void ResizeCache(size_t new_cache_size) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+
+    //! Set a function to call before the underlying leveldb database is
+    //! closed, which happens when resizing its cache and on destruction, so
+    //! that iterators over it can be released first.
+    void SetBeforeClose(std::function<void()> before_close) EXCLUSIVE_LOCKS_REQUIRED(cs_main) { m_before_close = std::move(before_close); }
 };
 
 #endif // BITCOIN_TXDB_H
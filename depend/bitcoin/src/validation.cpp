@@ -5665,6 +5665,8 @@ util::Result<CBlockIndex*> ChainstateManager::ActivateSnapshot(
     }
 
     auto cleanup_bad_snapshot = [&](bilingual_str reason) EXCLUSIVE_LOCKS_REQUIRED(::cs_main) {
+        // Loading is no longer in progress, without having completed.
+        GetNotifications().progress(bilingual_str{}, 0, false);
         this->MaybeRebalanceCaches();
 
         // PopulateAndValidateSnapshot can return (in error) before the leveldb datadir
@@ -5714,6 +5716,7 @@ util::Result<CBlockIndex*> ChainstateManager::ActivateSnapshot(
               chainstate.CoinsTip().DynamicMemoryUsage() / (1000 * 1000));
 
     this->MaybeRebalanceCaches();
+    GetNotifications().progress(bilingual_str{}, 100, false);
     return snapshot_start_block;
 }
 
@@ -5782,6 +5785,7 @@ util::Result<void> ChainstateManager::PopulateAndValidateSnapshot(
     uint64_t coins_left = metadata.m_coins_count;
 
     LogInfo("[snapshot] loading %d coins from snapshot %s", coins_left, base_blockhash.ToString());
+    GetNotifications().progress(_("Loading UTXO snapshot…"), 0, false);
     int64_t coins_processed{0};
 
     while (coins_left > 0) {
@@ -5821,6 +5825,7 @@ util::Result<void> ChainstateManager::PopulateAndValidateSnapshot(
                         coins_processed,
                         static_cast<float>(coins_processed) * 100 / static_cast<float>(coins_count),
                         coins_cache.DynamicMemoryUsage() / (1000 * 1000));
+                    GetNotifications().progress(_("Loading UTXO snapshot…"), static_cast<int>(coins_processed * 100 / coins_count), false);
                 }
 
                 // Batch write and flush (if we need to) every so often.
@@ -1,6 +1,7 @@
 from pbk.block import (
     Block,
     BlockCheckFlags,
+    BlockColumns,
     BlockHash,
     BlockHeader,
     BlockTreeEntry,
@@ -13,17 +14,24 @@ from pbk.block import (
 )
 from pbk.chain import (
     BlockMap,
+    BlockRangeReader,
     BlockSpentOutputsMap,
     BlockTreeEntryMap,
     BlockTreeEntrySequence,
     Chain,
     ChainParameters,
+    ChainSnapshot,
     ChainstateManager,
     ChainstateManagerOptions,
     ChainType,
+    CoinMap,
+    CoinsCursor,
     ConsensusParams,
+    RawBlockMap,
+    UtxoHashType,
+    UtxoStats,
 )
-from pbk.context import Context, ContextOptions
+from pbk.context import Context, ContextOptions, ValidationQueueOverflow
 from pbk.log import (
     KernelLogViewer,
     LogCategory,
@@ -35,12 +43,21 @@ from pbk.log import (
     logging_set_options,
     set_log_level_category,
 )
+from pbk.mempool import (
+    Mempool,
+    MempoolAcceptResult,
+    MempoolOptions,
+    PackageAcceptance,
+    TransactionAcceptance,
+)
 from pbk.script import (
     PrecomputedTransactionData,
+    ScriptCheckQueue,
     ScriptPubkey,
     ScriptVerificationFlags,
     ScriptVerifyException,
     ScriptVerifyStatus,
+    SignatureCache,
 )
 from pbk.transaction import (
     Coin,
@@ -71,15 +88,20 @@ __all__ = [
     "Block",
     "BlockCheckFlags",
     "BlockMap",
+    "BlockRangeReader",
+    "BlockColumns",
     "BlockSpentOutputs",
     "BlockValidationResult",
     "BlockValidationState",
     "Chain",
     "ChainParameters",
+    "ChainSnapshot",
     "ChainstateManager",
     "ChainstateManagerOptions",
     "ChainType",
     "Coin",
+    "CoinMap",
+    "CoinsCursor",
     "ConsensusParams",
     "CoinSequence",
     "Context",
@@ -90,14 +112,22 @@ __all__ = [
     "LogLevel",
     "LoggingConnection",
     "LoggingOptions",
+    "Mempool",
+    "MempoolAcceptResult",
+    "MempoolOptions",
+    "PackageAcceptance",
     "PrecomputedTransactionData",
     "ProcessBlockException",
     "ProcessBlockHeaderException",
+    "RawBlockMap",
+    "ScriptCheckQueue",
     "ScriptPubkey",
     "ScriptVerificationFlags",
     "ScriptVerifyException",
     "ScriptVerifyStatus",
+    "SignatureCache",
     "Transaction",
+    "TransactionAcceptance",
     "TransactionInput",
     "TransactionInputSequence",
     "TransactionOutput",
@@ -107,8 +137,11 @@ __all__ = [
     "TransactionSequence",
     "TransactionSpentOutputs",
     "Txid",
+    "UtxoHashType",
+    "UtxoStats",
     "ValidationMode",
     "ValidationInterfaceCallbacks",
+    "ValidationQueueOverflow",
     "disable_log_category",
     "enable_log_category",
     "logging_set_options",
@@ -7,7 +7,7 @@ import pbk.capi.bindings as k
 from pbk.capi import KernelOpaquePtr
 from pbk.transaction import Transaction, TransactionSpentOutputs
 from pbk.util.sequence import LazySequence
-from pbk.writer import ByteWriter
+from pbk.writer import write_to_buffer
 
 if typing.TYPE_CHECKING:
     from pbk.chain import ConsensusParams
@@ -180,6 +180,25 @@ class BlockTreeEntry(KernelOpaquePtr):
         """
         return k.btck_block_tree_entry_get_height(self)
 
+    @property
+    def has_data(self) -> bool:
+        """Whether the full block is stored on disk.
+
+        Returns:
+            False if the block has not been received yet or was pruned.
+        """
+        return bool(k.btck_block_tree_entry_has_data(self))
+
+    @property
+    def has_undo(self) -> bool:
+        """Whether the spent outputs (undo data) of the block are stored on disk.
+
+        Returns:
+            False if the block has not been connected yet or was pruned.
+            Always False for the genesis block.
+        """
+        return bool(k.btck_block_tree_entry_has_undo(self))
+
     @property
     def previous(self) -> "BlockTreeEntry":
         """The parent block tree entry.
@@ -427,8 +446,9 @@ class Block(KernelOpaquePtr):
             The serialized block data in consensus format, suitable for
             P2P network transmission.
         """
-        writer = ByteWriter()
-        return writer.write(k.btck_block_to_bytes, self)
+        return bytes(
+            write_to_buffer(k.btck_block_serialized_size, k.btck_block_to_buffer, self)
+        )
 
     def _get_transaction_at(self, transaction_index: int) -> Transaction:
         """Get the transaction at the given index."""
@@ -445,6 +465,26 @@ class Block(KernelOpaquePtr):
         """
         return TransactionSequence(self)
 
+    def to_columns(
+        self, spent_outputs: typing.Optional["BlockSpentOutputs"] = None
+    ) -> "BlockColumns":
+        """Flatten this block into contiguous arrays, one per field.
+
+        Args:
+            spent_outputs: The spent outputs of this block. If given, the
+                spent output arrays of the result are filled in as well.
+
+        Returns:
+            The block columns. Owned handle.
+
+        Raises:
+            ValueError: If `spent_outputs` do not belong to this block.
+        """
+        ptr = k.btck_block_columns_create(self, spent_outputs)
+        if not ptr:
+            raise ValueError("Spent outputs do not match the block.")
+        return BlockColumns._from_handle(ptr)
+
     def check(
         self,
         consensus_params: "ConsensusParams",
@@ -544,3 +584,137 @@ class BlockSpentOutputs(KernelOpaquePtr):
     def __repr__(self) -> str:
         """Return a string representation of the block spent outputs."""
         return f"<BlockSpentOutputs txs={len(self.transactions)}>"
+
+
+class _BlockColumn(IntEnum):
+    """Identifiers of the arrays held by [BlockColumns][pbk.BlockColumns]."""
+
+    TX_INPUT_OFFSETS = 0
+    TX_OUTPUT_OFFSETS = 1
+    TXIDS = 2
+    INPUT_PREVOUT_TXIDS = 3
+    INPUT_PREVOUT_INDICES = 4
+    OUTPUT_AMOUNTS = 5
+    OUTPUT_SCRIPT_OFFSETS = 6
+    OUTPUT_SCRIPTS = 7
+    SPENT_AMOUNTS = 8
+    SPENT_HEIGHTS = 9
+    SPENT_IS_COINBASE = 10
+    SPENT_SCRIPT_OFFSETS = 11
+    SPENT_SCRIPTS = 12
+
+
+class BlockColumns(KernelOpaquePtr):
+    """The contents of a block flattened into contiguous arrays.
+
+    Each field of the block is exported as one array, built in a single pass
+    over the block, so that bulk consumers can load a block without creating
+    a Python object per transaction, input and output. Arrays are exposed as
+    read-only `memoryview`s into the columns, which stay alive for as long as
+    any of the views does.
+
+    Per transaction arrays are indexed by the position of the transaction in
+    the block, input and output arrays by the position of the input or output
+    across all transactions. Offset arrays have one more element than the
+    arrays they index into, so the inputs of transaction `i` are in
+    `range(tx_input_offsets[i], tx_input_offsets[i + 1])`.
+    """
+
+    # Non-instantiable, created with Block.to_columns
+    _destroy_fn = k.btck_block_columns_destroy
+
+    def _get(self, column: _BlockColumn, fmt: str, item_size: int) -> memoryview:
+        length = ctypes.c_uint64()
+        ptr = k.btck_block_columns_get(self, column, ctypes.byref(length))
+        if not ptr:
+            return memoryview(b"").cast(fmt)
+        data = (ctypes.c_char * (length.value * item_size)).from_address(ptr)
+        data._owner = self  # keep the columns alive while the view is in use
+        return memoryview(data).cast("B").cast(fmt).toreadonly()
+
+    @property
+    def tx_input_offsets(self) -> memoryview:
+        """Index of the first input of each transaction, as `uint32`."""
+        return self._get(_BlockColumn.TX_INPUT_OFFSETS, "I", 4)
+
+    @property
+    def tx_output_offsets(self) -> memoryview:
+        """Index of the first output of each transaction, as `uint32`."""
+        return self._get(_BlockColumn.TX_OUTPUT_OFFSETS, "I", 4)
+
+    @property
+    def txids(self) -> memoryview:
+        """Concatenated 32-byte txids of all transactions."""
+        return self._get(_BlockColumn.TXIDS, "B", 32)
+
+    @property
+    def input_prevout_txids(self) -> memoryview:
+        """Concatenated 32-byte txids of the outputs spent by the inputs."""
+        return self._get(_BlockColumn.INPUT_PREVOUT_TXIDS, "B", 32)
+
+    @property
+    def input_prevout_indices(self) -> memoryview:
+        """Index of the output spent by each input, as `uint32`."""
+        return self._get(_BlockColumn.INPUT_PREVOUT_INDICES, "I", 4)
+
+    @property
+    def output_amounts(self) -> memoryview:
+        """Amount of each output in satoshis, as `int64`."""
+        return self._get(_BlockColumn.OUTPUT_AMOUNTS, "q", 8)
+
+    @property
+    def output_script_offsets(self) -> memoryview:
+        """Offset of each output's script pubkey in `output_scripts`, as `uint32`."""
+        return self._get(_BlockColumn.OUTPUT_SCRIPT_OFFSETS, "I", 4)
+
+    @property
+    def output_scripts(self) -> memoryview:
+        """Concatenated script pubkeys of all outputs."""
+        return self._get(_BlockColumn.OUTPUT_SCRIPTS, "B", 1)
+
+    @property
+    def spent_amounts(self) -> memoryview:
+        """Amount of the output spent by each input, as `int64`.
+
+        Empty if the columns were created without spent outputs. Zero for the
+        coinbase input, which does not spend an output.
+        """
+        return self._get(_BlockColumn.SPENT_AMOUNTS, "q", 8)
+
+    @property
+    def spent_heights(self) -> memoryview:
+        """Confirmation height of the output spent by each input, as `uint32`.
+
+        Empty if the columns were created without spent outputs.
+        """
+        return self._get(_BlockColumn.SPENT_HEIGHTS, "I", 4)
+
+    @property
+    def spent_is_coinbase(self) -> memoryview:
+        """Whether the output spent by each input was created by a coinbase.
+
+        One byte per input, empty if the columns were created without spent
+        outputs.
+        """
+        return self._get(_BlockColumn.SPENT_IS_COINBASE, "B", 1)
+
+    @property
+    def spent_script_offsets(self) -> memoryview:
+        """Offset of each spent script pubkey in `spent_scripts`, as `uint32`.
+
+        Empty if the columns were created without spent outputs.
+        """
+        return self._get(_BlockColumn.SPENT_SCRIPT_OFFSETS, "I", 4)
+
+    @property
+    def spent_scripts(self) -> memoryview:
+        """Concatenated script pubkeys of all spent outputs."""
+        return self._get(_BlockColumn.SPENT_SCRIPTS, "B", 1)
+
+    def __repr__(self) -> str:
+        """Return a string representation of the block columns."""
+        return (
+            f"<BlockColumns txs={len(self.tx_output_offsets) - 1} "
+            f"inputs={len(self.input_prevout_indices)} "
+            f"outputs={len(self.output_amounts)}>"
+        )
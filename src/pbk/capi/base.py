@@ -17,6 +17,28 @@ else:
     Self = typing.TypeVar("Self")
 
 
+class _RevokedPtr:
+    """Stands in for the pointer of a kernel object that is no longer borrowed.
+
+    ctypes looks up `_as_parameter_` when the object is passed to a C
+    function, so that raises (wrapped in a `ctypes.ArgumentError`) instead of
+    passing a dangling pointer.
+    """
+
+    @property
+    def _as_parameter_(self) -> typing.NoReturn:
+        raise RuntimeError(
+            "Kernel object is no longer valid, it was only borrowed for the "
+            "duration of a callback"
+        )
+
+    def __bool__(self) -> bool:
+        return False
+
+
+_REVOKED_PTR = _RevokedPtr()
+
+
 class KernelOpaquePtr:
     """Base class for wrapping opaque C pointers from bitcoinkernel.
 
@@ -38,6 +60,10 @@ class KernelOpaquePtr:
             when garbage collected.
         _parent: Optional parent object that must be kept alive for the lifetime
             of this object to prevent premature destruction.
+        _borrowed: For an object the kernel only lends for a limited time, the
+            list of it and the views into it that are not detached yet. It is
+            shared by all of them, so that the lender can set their
+            `_as_parameter_` to `_REVOKED_PTR` once it takes the object back.
         _create_fn: Constructor function for creating new C objects. If None,
             the class cannot be instantiated directly.
         _destroy_fn: Destructor function for freeing C objects. If None,
@@ -49,6 +75,9 @@ class KernelOpaquePtr:
     _parent = (
         None  # Parent object that must be kept alive for the lifetime of this object
     )
+    _borrowed: list[KernelOpaquePtr] | None = (
+        None  # If set, the object is only valid until it is revoked
+    )
     _create_fn: Callable | None = None  # If None, cannot be created directly
     _destroy_fn: Callable | None = (
         None  # If None, cannot be destroyed. Should only be used for view-only classes.
@@ -121,12 +150,17 @@ class KernelOpaquePtr:
                 while the view exists.
 
         Returns:
-            A new instance wrapping the unowned pointer.
+            A new instance wrapping the unowned pointer. It is borrowed along
+            with the parent, if that is borrowed.
 
         Raises:
             ValueError: If the pointer is null, as propagated from `_from_ptr`.
         """
-        return cls._from_ptr(ptr, owns_ptr=False, parent=parent)
+        instance = cls._from_ptr(ptr, owns_ptr=False, parent=parent)
+        if parent is not None and parent._borrowed is not None:
+            instance._borrowed = parent._borrowed
+            instance._borrowed.append(instance)
+        return instance
 
     @classmethod
     def _from_ptr(
@@ -222,6 +256,9 @@ class KernelOpaquePtr:
         self._as_parameter_ = self._copy_ptr()
         self._owns_ptr = True
         self._parent = None
+        if self._borrowed is not None:
+            self._borrowed.remove(self)
+            self._borrowed = None
         return self
 
     def __copy__(self) -> Self:
@@ -200,6 +200,10 @@ class struct_btck_Chain(Structure):
     pass
 
 btck_Chain = struct_btck_Chain
+class struct_btck_ChainSnapshot(Structure):
+    pass
+
+btck_ChainSnapshot = struct_btck_ChainSnapshot
 class struct_btck_BlockSpentOutputs(Structure):
     pass
 
@@ -236,6 +240,38 @@ class struct_btck_BlockHeader(Structure):
     pass
 
 btck_BlockHeader = struct_btck_BlockHeader
+class struct_btck_UtxoStats(Structure):
+    pass
+
+btck_UtxoStats = struct_btck_UtxoStats
+class struct_btck_CoinsCursor(Structure):
+    pass
+
+btck_CoinsCursor = struct_btck_CoinsCursor
+class struct_btck_BlockRangeReader(Structure):
+    pass
+
+btck_BlockRangeReader = struct_btck_BlockRangeReader
+class struct_btck_BlockColumns(Structure):
+    pass
+
+btck_BlockColumns = struct_btck_BlockColumns
+class struct_btck_ScriptCheckQueue(Structure):
+    pass
+
+btck_ScriptCheckQueue = struct_btck_ScriptCheckQueue
+class struct_btck_SignatureCache(Structure):
+    pass
+
+btck_SignatureCache = struct_btck_SignatureCache
+class struct_btck_MempoolOptions(Structure):
+    pass
+
+btck_MempoolOptions = struct_btck_MempoolOptions
+class struct_btck_Mempool(Structure):
+    pass
+
+btck_Mempool = struct_btck_Mempool
 btck_SynchronizationState = ctypes.c_ubyte
 btck_Warning = ctypes.c_ubyte
 btck_LogCallback = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(ctypes.c_char), ctypes.c_uint64)
@@ -251,7 +287,15 @@ btck_ValidationInterfaceBlockChecked = ctypes.CFUNCTYPE(None, ctypes.POINTER(Non
 btck_ValidationInterfacePoWValidBlock = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))
 btck_ValidationInterfaceBlockConnected = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))
 btck_ValidationInterfaceBlockDisconnected = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))
+btck_ValidationInterfaceBorrowedBlockChecked = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockValidationState))
+btck_ValidationInterfaceBorrowedPoWValidBlock = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))
+btck_ValidationInterfaceBorrowedBlockConnected = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))
+btck_ValidationInterfaceBorrowedBlockDisconnected = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))
 btck_WriteBytes = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.POINTER(None), ctypes.c_uint64, ctypes.POINTER(None))
+btck_UtxoStatsProgress = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.c_uint64)
+btck_BlockProcessed = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.c_int32, ctypes.c_int32)
+btck_ReadBytes = ctypes.CFUNCTYPE(ctypes.c_int64, ctypes.POINTER(None), ctypes.c_uint64, ctypes.POINTER(None))
+btck_ImportProgress = ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.c_uint64, ctypes.c_uint64, ctypes.c_double, ctypes.c_double)
 btck_ValidationMode = ctypes.c_ubyte
 btck_BlockValidationResult = ctypes.c_uint32
 class struct_btck_ValidationInterfaceCallbacks(Structure):
@@ -265,6 +309,10 @@ struct_btck_ValidationInterfaceCallbacks._fields_ = [
     ('pow_valid_block', ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))),
     ('block_connected', ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))),
     ('block_disconnected', ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))),
+    ('borrowed_block_checked', ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockValidationState))),
+    ('borrowed_pow_valid_block', ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))),
+    ('borrowed_block_connected', ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))),
+    ('borrowed_block_disconnected', ctypes.CFUNCTYPE(None, ctypes.POINTER(None), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockTreeEntry))),
 ]
 
 btck_ValidationInterfaceCallbacks = struct_btck_ValidationInterfaceCallbacks
@@ -322,6 +370,18 @@ try:
     btck_transaction_to_bytes.argtypes = [ctypes.POINTER(struct_btck_Transaction), btck_WriteBytes, ctypes.POINTER(None)]
 except AttributeError:
     pass
+try:
+    btck_transaction_serialized_size = BITCOINKERNEL_LIB.btck_transaction_serialized_size
+    btck_transaction_serialized_size.restype = size_t
+    btck_transaction_serialized_size.argtypes = [ctypes.POINTER(struct_btck_Transaction)]
+except AttributeError:
+    pass
+try:
+    btck_transaction_to_buffer = BITCOINKERNEL_LIB.btck_transaction_to_buffer
+    btck_transaction_to_buffer.restype = ctypes.c_int32
+    btck_transaction_to_buffer.argtypes = [ctypes.POINTER(struct_btck_Transaction), ctypes.POINTER(None), size_t]
+except AttributeError:
+    pass
 try:
     btck_transaction_count_outputs = BITCOINKERNEL_LIB.btck_transaction_count_outputs
     btck_transaction_count_outputs.restype = size_t
@@ -359,6 +419,12 @@ try:
     btck_transaction_get_txid.argtypes = [ctypes.POINTER(struct_btck_Transaction)]
 except AttributeError:
     pass
+try:
+    btck_transaction_verify_inputs = BITCOINKERNEL_LIB.btck_transaction_verify_inputs
+    btck_transaction_verify_inputs.restype = ctypes.c_int32
+    btck_transaction_verify_inputs.argtypes = [ctypes.POINTER(struct_btck_Transaction), ctypes.POINTER(ctypes.POINTER(struct_btck_TransactionOutput)), size_t, btck_ScriptVerificationFlags, ctypes.POINTER(struct_btck_ScriptCheckQueue), ctypes.POINTER(struct_btck_SignatureCache), ctypes.POINTER(ctypes.c_int32), ctypes.POINTER(ctypes.c_ubyte)]
+except AttributeError:
+    pass
 try:
     btck_transaction_destroy = BITCOINKERNEL_LIB.btck_transaction_destroy
     btck_transaction_destroy.restype = None
@@ -383,6 +449,36 @@ try:
     btck_precomputed_transaction_data_destroy.argtypes = [ctypes.POINTER(struct_btck_PrecomputedTransactionData)]
 except AttributeError:
     pass
+try:
+    btck_script_check_queue_create = BITCOINKERNEL_LIB.btck_script_check_queue_create
+    btck_script_check_queue_create.restype = ctypes.POINTER(struct_btck_ScriptCheckQueue)
+    btck_script_check_queue_create.argtypes = [ctypes.c_int32]
+except AttributeError:
+    pass
+try:
+    btck_script_check_queue_destroy = BITCOINKERNEL_LIB.btck_script_check_queue_destroy
+    btck_script_check_queue_destroy.restype = None
+    btck_script_check_queue_destroy.argtypes = [ctypes.POINTER(struct_btck_ScriptCheckQueue)]
+except AttributeError:
+    pass
+try:
+    btck_signature_cache_create = BITCOINKERNEL_LIB.btck_signature_cache_create
+    btck_signature_cache_create.restype = ctypes.POINTER(struct_btck_SignatureCache)
+    btck_signature_cache_create.argtypes = [size_t, size_t]
+except AttributeError:
+    pass
+try:
+    btck_signature_cache_get_hits = BITCOINKERNEL_LIB.btck_signature_cache_get_hits
+    btck_signature_cache_get_hits.restype = ctypes.c_uint64
+    btck_signature_cache_get_hits.argtypes = [ctypes.POINTER(struct_btck_SignatureCache)]
+except AttributeError:
+    pass
+try:
+    btck_signature_cache_destroy = BITCOINKERNEL_LIB.btck_signature_cache_destroy
+    btck_signature_cache_destroy.restype = None
+    btck_signature_cache_destroy.argtypes = [ctypes.POINTER(struct_btck_SignatureCache)]
+except AttributeError:
+    pass
 try:
     btck_script_pubkey_create = BITCOINKERNEL_LIB.btck_script_pubkey_create
     btck_script_pubkey_create.restype = ctypes.POINTER(struct_btck_ScriptPubkey)
@@ -402,6 +498,12 @@ try:
     btck_script_pubkey_verify.argtypes = [ctypes.POINTER(struct_btck_ScriptPubkey), int64_t, ctypes.POINTER(struct_btck_Transaction), ctypes.POINTER(struct_btck_PrecomputedTransactionData), ctypes.c_uint32, btck_ScriptVerificationFlags, ctypes.POINTER(ctypes.c_ubyte)]
 except AttributeError:
     pass
+try:
+    btck_script_pubkey_verify_cached = BITCOINKERNEL_LIB.btck_script_pubkey_verify_cached
+    btck_script_pubkey_verify_cached.restype = ctypes.c_int32
+    btck_script_pubkey_verify_cached.argtypes = [ctypes.POINTER(struct_btck_ScriptPubkey), int64_t, ctypes.POINTER(struct_btck_Transaction), ctypes.POINTER(struct_btck_PrecomputedTransactionData), ctypes.c_uint32, btck_ScriptVerificationFlags, ctypes.POINTER(struct_btck_SignatureCache), ctypes.POINTER(ctypes.c_ubyte)]
+except AttributeError:
+    pass
 try:
     btck_script_pubkey_to_bytes = BITCOINKERNEL_LIB.btck_script_pubkey_to_bytes
     btck_script_pubkey_to_bytes.restype = ctypes.c_int32
@@ -498,6 +600,12 @@ try:
     btck_chain_parameters_copy.argtypes = [ctypes.POINTER(struct_btck_ChainParameters)]
 except AttributeError:
     pass
+try:
+    btck_chain_parameters_add_assumeutxo = BITCOINKERNEL_LIB.btck_chain_parameters_add_assumeutxo
+    btck_chain_parameters_add_assumeutxo.restype = ctypes.c_int32
+    btck_chain_parameters_add_assumeutxo.argtypes = [ctypes.POINTER(struct_btck_ChainParameters), ctypes.c_int32, ctypes.POINTER(struct_btck_BlockHash), ctypes.c_ubyte * 32, ctypes.c_uint64]
+except AttributeError:
+    pass
 try:
     btck_chain_parameters_get_consensus_params = BITCOINKERNEL_LIB.btck_chain_parameters_get_consensus_params
     btck_chain_parameters_get_consensus_params.restype = ctypes.POINTER(struct_btck_ConsensusParams)
@@ -534,6 +642,19 @@ try:
     btck_context_options_set_validation_interface.argtypes = [ctypes.POINTER(struct_btck_ContextOptions), btck_ValidationInterfaceCallbacks]
 except AttributeError:
     pass
+btck_ValidationQueueOverflow = ctypes.c_ubyte
+try:
+    btck_context_options_set_validation_interface_queue = BITCOINKERNEL_LIB.btck_context_options_set_validation_interface_queue
+    btck_context_options_set_validation_interface_queue.restype = ctypes.c_int32
+    btck_context_options_set_validation_interface_queue.argtypes = [ctypes.POINTER(struct_btck_ContextOptions), size_t, btck_ValidationQueueOverflow]
+except AttributeError:
+    pass
+try:
+    btck_context_options_set_tip_notification_limit = BITCOINKERNEL_LIB.btck_context_options_set_tip_notification_limit
+    btck_context_options_set_tip_notification_limit.restype = ctypes.c_int32
+    btck_context_options_set_tip_notification_limit.argtypes = [ctypes.POINTER(struct_btck_ContextOptions), ctypes.c_int64, ctypes.c_int64]
+except AttributeError:
+    pass
 try:
     btck_context_options_destroy = BITCOINKERNEL_LIB.btck_context_options_destroy
     btck_context_options_destroy.restype = None
@@ -564,6 +685,12 @@ try:
     btck_context_destroy.argtypes = [ctypes.POINTER(struct_btck_Context)]
 except AttributeError:
     pass
+try:
+    btck_context_sync_validation_interface_queue = BITCOINKERNEL_LIB.btck_context_sync_validation_interface_queue
+    btck_context_sync_validation_interface_queue.restype = None
+    btck_context_sync_validation_interface_queue.argtypes = [ctypes.POINTER(struct_btck_Context)]
+except AttributeError:
+    pass
 try:
     btck_block_tree_entry_get_previous = BITCOINKERNEL_LIB.btck_block_tree_entry_get_previous
     btck_block_tree_entry_get_previous.restype = ctypes.POINTER(struct_btck_BlockTreeEntry)
@@ -601,6 +728,18 @@ try:
     btck_block_tree_entry_get_ancestor.argtypes = [ctypes.POINTER(struct_btck_BlockTreeEntry), int32_t]
 except AttributeError:
     pass
+try:
+    btck_block_tree_entry_has_data = BITCOINKERNEL_LIB.btck_block_tree_entry_has_data
+    btck_block_tree_entry_has_data.restype = ctypes.c_int32
+    btck_block_tree_entry_has_data.argtypes = [ctypes.POINTER(struct_btck_BlockTreeEntry)]
+except AttributeError:
+    pass
+try:
+    btck_block_tree_entry_has_undo = BITCOINKERNEL_LIB.btck_block_tree_entry_has_undo
+    btck_block_tree_entry_has_undo.restype = ctypes.c_int32
+    btck_block_tree_entry_has_undo.argtypes = [ctypes.POINTER(struct_btck_BlockTreeEntry)]
+except AttributeError:
+    pass
 try:
     btck_chainstate_manager_options_create = BITCOINKERNEL_LIB.btck_chainstate_manager_options_create
     btck_chainstate_manager_options_create.restype = ctypes.POINTER(struct_btck_ChainstateManagerOptions)
@@ -613,6 +752,48 @@ try:
     btck_chainstate_manager_options_set_worker_threads_num.argtypes = [ctypes.POINTER(struct_btck_ChainstateManagerOptions), ctypes.c_int32]
 except AttributeError:
     pass
+try:
+    btck_chainstate_manager_options_set_total_cache_size = BITCOINKERNEL_LIB.btck_chainstate_manager_options_set_total_cache_size
+    btck_chainstate_manager_options_set_total_cache_size.restype = None
+    btck_chainstate_manager_options_set_total_cache_size.argtypes = [ctypes.POINTER(struct_btck_ChainstateManagerOptions), size_t]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_options_set_cache_sizes = BITCOINKERNEL_LIB.btck_chainstate_manager_options_set_cache_sizes
+    btck_chainstate_manager_options_set_cache_sizes.restype = None
+    btck_chainstate_manager_options_set_cache_sizes.argtypes = [ctypes.POINTER(struct_btck_ChainstateManagerOptions), size_t, size_t, size_t]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_options_set_prune_target = BITCOINKERNEL_LIB.btck_chainstate_manager_options_set_prune_target
+    btck_chainstate_manager_options_set_prune_target.restype = ctypes.c_int32
+    btck_chainstate_manager_options_set_prune_target.argtypes = [ctypes.POINTER(struct_btck_ChainstateManagerOptions), ctypes.c_uint64]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_options_set_fast_prune = BITCOINKERNEL_LIB.btck_chainstate_manager_options_set_fast_prune
+    btck_chainstate_manager_options_set_fast_prune.restype = None
+    btck_chainstate_manager_options_set_fast_prune.argtypes = [ctypes.POINTER(struct_btck_ChainstateManagerOptions), ctypes.c_int32]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_options_set_assumed_valid = BITCOINKERNEL_LIB.btck_chainstate_manager_options_set_assumed_valid
+    btck_chainstate_manager_options_set_assumed_valid.restype = None
+    btck_chainstate_manager_options_set_assumed_valid.argtypes = [ctypes.POINTER(struct_btck_ChainstateManagerOptions), ctypes.POINTER(struct_btck_BlockHash)]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_options_set_minimum_chain_work = BITCOINKERNEL_LIB.btck_chainstate_manager_options_set_minimum_chain_work
+    btck_chainstate_manager_options_set_minimum_chain_work.restype = None
+    btck_chainstate_manager_options_set_minimum_chain_work.argtypes = [ctypes.POINTER(struct_btck_ChainstateManagerOptions), ctypes.c_ubyte * 32]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_options_set_mempool = BITCOINKERNEL_LIB.btck_chainstate_manager_options_set_mempool
+    btck_chainstate_manager_options_set_mempool.restype = None
+    btck_chainstate_manager_options_set_mempool.argtypes = [ctypes.POINTER(struct_btck_ChainstateManagerOptions), ctypes.POINTER(struct_btck_MempoolOptions)]
+except AttributeError:
+    pass
 try:
     btck_chainstate_manager_options_set_wipe_dbs = BITCOINKERNEL_LIB.btck_chainstate_manager_options_set_wipe_dbs
     btck_chainstate_manager_options_set_wipe_dbs.restype = ctypes.c_int32
@@ -655,30 +836,108 @@ try:
     btck_chainstate_manager_process_block_header.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(struct_btck_BlockHeader), ctypes.POINTER(struct_btck_BlockValidationState)]
 except AttributeError:
     pass
+try:
+    btck_chainstate_manager_process_block_headers = BITCOINKERNEL_LIB.btck_chainstate_manager_process_block_headers
+    btck_chainstate_manager_process_block_headers.restype = ctypes.c_int32
+    btck_chainstate_manager_process_block_headers.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(ctypes.POINTER(struct_btck_BlockHeader)), size_t, ctypes.POINTER(struct_btck_BlockValidationState), ctypes.POINTER(ctypes.POINTER(struct_btck_BlockTreeEntry))]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_process_raw_block_headers = BITCOINKERNEL_LIB.btck_chainstate_manager_process_raw_block_headers
+    btck_chainstate_manager_process_raw_block_headers.restype = ctypes.c_int32
+    btck_chainstate_manager_process_raw_block_headers.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(None), size_t, ctypes.POINTER(struct_btck_BlockValidationState), ctypes.POINTER(ctypes.POINTER(struct_btck_BlockTreeEntry))]
+except AttributeError:
+    pass
 try:
     btck_chainstate_manager_import_blocks = BITCOINKERNEL_LIB.btck_chainstate_manager_import_blocks
     btck_chainstate_manager_import_blocks.restype = ctypes.c_int32
     btck_chainstate_manager_import_blocks.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(ctypes.POINTER(ctypes.c_char)), ctypes.POINTER(ctypes.c_uint64), size_t]
 except AttributeError:
     pass
+try:
+    btck_chainstate_manager_import_blocks_parallel = BITCOINKERNEL_LIB.btck_chainstate_manager_import_blocks_parallel
+    btck_chainstate_manager_import_blocks_parallel.restype = ctypes.c_int32
+    btck_chainstate_manager_import_blocks_parallel.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(ctypes.POINTER(ctypes.c_char)), ctypes.POINTER(ctypes.c_uint64), size_t, ctypes.c_int32, btck_ImportProgress, ctypes.POINTER(None)]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_import_blocks_from_stream = BITCOINKERNEL_LIB.btck_chainstate_manager_import_blocks_from_stream
+    btck_chainstate_manager_import_blocks_from_stream.restype = ctypes.c_int32
+    btck_chainstate_manager_import_blocks_from_stream.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), btck_ReadBytes, ctypes.c_int32, btck_ImportProgress, ctypes.POINTER(None)]
+except AttributeError:
+    pass
 try:
     btck_chainstate_manager_process_block = BITCOINKERNEL_LIB.btck_chainstate_manager_process_block
     btck_chainstate_manager_process_block.restype = ctypes.c_int32
     btck_chainstate_manager_process_block.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(struct_btck_Block), ctypes.POINTER(ctypes.c_int32)]
 except AttributeError:
     pass
+try:
+    btck_chainstate_manager_submit_block = BITCOINKERNEL_LIB.btck_chainstate_manager_submit_block
+    btck_chainstate_manager_submit_block.restype = ctypes.c_int32
+    btck_chainstate_manager_submit_block.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(struct_btck_Block), btck_BlockProcessed, ctypes.POINTER(None)]
+except AttributeError:
+    pass
 try:
     btck_chainstate_manager_get_active_chain = BITCOINKERNEL_LIB.btck_chainstate_manager_get_active_chain
     btck_chainstate_manager_get_active_chain.restype = ctypes.POINTER(struct_btck_Chain)
     btck_chainstate_manager_get_active_chain.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager)]
 except AttributeError:
     pass
+try:
+    btck_chainstate_manager_get_mempool = BITCOINKERNEL_LIB.btck_chainstate_manager_get_mempool
+    btck_chainstate_manager_get_mempool.restype = ctypes.POINTER(struct_btck_Mempool)
+    btck_chainstate_manager_get_mempool.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager)]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_activate_snapshot = BITCOINKERNEL_LIB.btck_chainstate_manager_activate_snapshot
+    btck_chainstate_manager_activate_snapshot.restype = ctypes.POINTER(struct_btck_BlockTreeEntry)
+    btck_chainstate_manager_activate_snapshot.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(ctypes.c_char), ctypes.c_uint64]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_prune_to_height = BITCOINKERNEL_LIB.btck_chainstate_manager_prune_to_height
+    btck_chainstate_manager_prune_to_height.restype = ctypes.c_int32
+    btck_chainstate_manager_prune_to_height.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.c_int32]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_dump_snapshot = BITCOINKERNEL_LIB.btck_chainstate_manager_dump_snapshot
+    btck_chainstate_manager_dump_snapshot.restype = ctypes.POINTER(struct_btck_BlockTreeEntry)
+    btck_chainstate_manager_dump_snapshot.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(ctypes.c_char), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64)]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_get_background_chain = BITCOINKERNEL_LIB.btck_chainstate_manager_get_background_chain
+    btck_chainstate_manager_get_background_chain.restype = ctypes.POINTER(struct_btck_Chain)
+    btck_chainstate_manager_get_background_chain.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager)]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_get_background_target = BITCOINKERNEL_LIB.btck_chainstate_manager_get_background_target
+    btck_chainstate_manager_get_background_target.restype = ctypes.POINTER(struct_btck_BlockTreeEntry)
+    btck_chainstate_manager_get_background_target.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager)]
+except AttributeError:
+    pass
 try:
     btck_chainstate_manager_get_block_tree_entry_by_hash = BITCOINKERNEL_LIB.btck_chainstate_manager_get_block_tree_entry_by_hash
     btck_chainstate_manager_get_block_tree_entry_by_hash.restype = ctypes.POINTER(struct_btck_BlockTreeEntry)
     btck_chainstate_manager_get_block_tree_entry_by_hash.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(struct_btck_BlockHash)]
 except AttributeError:
     pass
+try:
+    btck_chainstate_manager_get_coin = BITCOINKERNEL_LIB.btck_chainstate_manager_get_coin
+    btck_chainstate_manager_get_coin.restype = ctypes.POINTER(struct_btck_Coin)
+    btck_chainstate_manager_get_coin.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(struct_btck_TransactionOutPoint)]
+except AttributeError:
+    pass
+try:
+    btck_chainstate_manager_get_coins = BITCOINKERNEL_LIB.btck_chainstate_manager_get_coins
+    btck_chainstate_manager_get_coins.restype = ctypes.c_int32
+    btck_chainstate_manager_get_coins.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(ctypes.POINTER(struct_btck_TransactionOutPoint)), size_t, ctypes.POINTER(ctypes.POINTER(struct_btck_Coin))]
+except AttributeError:
+    pass
 try:
     btck_chainstate_manager_destroy = BITCOINKERNEL_LIB.btck_chainstate_manager_destroy
     btck_chainstate_manager_destroy.restype = None
@@ -691,6 +950,18 @@ try:
     btck_block_read.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(struct_btck_BlockTreeEntry)]
 except AttributeError:
     pass
+try:
+    btck_block_read_with_spent_outputs = BITCOINKERNEL_LIB.btck_block_read_with_spent_outputs
+    btck_block_read_with_spent_outputs.restype = ctypes.c_int32
+    btck_block_read_with_spent_outputs.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(struct_btck_BlockTreeEntry), ctypes.POINTER(ctypes.POINTER(struct_btck_Block)), ctypes.POINTER(ctypes.POINTER(struct_btck_BlockSpentOutputs))]
+except AttributeError:
+    pass
+try:
+    btck_block_read_raw = BITCOINKERNEL_LIB.btck_block_read_raw
+    btck_block_read_raw.restype = ctypes.c_int32
+    btck_block_read_raw.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(struct_btck_BlockTreeEntry), size_t, size_t, btck_WriteBytes, ctypes.POINTER(None)]
+except AttributeError:
+    pass
 try:
     btck_block_create = BITCOINKERNEL_LIB.btck_block_create
     btck_block_create.restype = ctypes.POINTER(struct_btck_Block)
@@ -740,12 +1011,43 @@ try:
     btck_block_to_bytes.argtypes = [ctypes.POINTER(struct_btck_Block), btck_WriteBytes, ctypes.POINTER(None)]
 except AttributeError:
     pass
+try:
+    btck_block_serialized_size = BITCOINKERNEL_LIB.btck_block_serialized_size
+    btck_block_serialized_size.restype = size_t
+    btck_block_serialized_size.argtypes = [ctypes.POINTER(struct_btck_Block)]
+except AttributeError:
+    pass
+try:
+    btck_block_to_buffer = BITCOINKERNEL_LIB.btck_block_to_buffer
+    btck_block_to_buffer.restype = ctypes.c_int32
+    btck_block_to_buffer.argtypes = [ctypes.POINTER(struct_btck_Block), ctypes.POINTER(None), size_t]
+except AttributeError:
+    pass
 try:
     btck_block_destroy = BITCOINKERNEL_LIB.btck_block_destroy
     btck_block_destroy.restype = None
     btck_block_destroy.argtypes = [ctypes.POINTER(struct_btck_Block)]
 except AttributeError:
     pass
+btck_BlockColumn = ctypes.c_ubyte
+try:
+    btck_block_columns_create = BITCOINKERNEL_LIB.btck_block_columns_create
+    btck_block_columns_create.restype = ctypes.POINTER(struct_btck_BlockColumns)
+    btck_block_columns_create.argtypes = [ctypes.POINTER(struct_btck_Block), ctypes.POINTER(struct_btck_BlockSpentOutputs)]
+except AttributeError:
+    pass
+try:
+    btck_block_columns_get = BITCOINKERNEL_LIB.btck_block_columns_get
+    btck_block_columns_get.restype = ctypes.POINTER(None)
+    btck_block_columns_get.argtypes = [ctypes.POINTER(struct_btck_BlockColumns), btck_BlockColumn, ctypes.POINTER(ctypes.c_uint64)]
+except AttributeError:
+    pass
+try:
+    btck_block_columns_destroy = BITCOINKERNEL_LIB.btck_block_columns_destroy
+    btck_block_columns_destroy.restype = None
+    btck_block_columns_destroy.argtypes = [ctypes.POINTER(struct_btck_BlockColumns)]
+except AttributeError:
+    pass
 try:
     btck_block_validation_state_create = BITCOINKERNEL_LIB.btck_block_validation_state_create
     btck_block_validation_state_create.restype = ctypes.POINTER(struct_btck_BlockValidationState)
@@ -776,6 +1078,73 @@ try:
     btck_block_validation_state_destroy.argtypes = [ctypes.POINTER(struct_btck_BlockValidationState)]
 except AttributeError:
     pass
+try:
+    btck_mempool_options_create = BITCOINKERNEL_LIB.btck_mempool_options_create
+    btck_mempool_options_create.restype = ctypes.POINTER(struct_btck_MempoolOptions)
+    btck_mempool_options_create.argtypes = []
+except AttributeError:
+    pass
+try:
+    btck_mempool_options_set_max_size = BITCOINKERNEL_LIB.btck_mempool_options_set_max_size
+    btck_mempool_options_set_max_size.restype = ctypes.c_int32
+    btck_mempool_options_set_max_size.argtypes = [ctypes.POINTER(struct_btck_MempoolOptions), ctypes.c_int64]
+except AttributeError:
+    pass
+try:
+    btck_mempool_options_set_expiry = BITCOINKERNEL_LIB.btck_mempool_options_set_expiry
+    btck_mempool_options_set_expiry.restype = ctypes.c_int32
+    btck_mempool_options_set_expiry.argtypes = [ctypes.POINTER(struct_btck_MempoolOptions), ctypes.c_int64]
+except AttributeError:
+    pass
+try:
+    btck_mempool_options_set_limits = BITCOINKERNEL_LIB.btck_mempool_options_set_limits
+    btck_mempool_options_set_limits.restype = ctypes.c_int32
+    btck_mempool_options_set_limits.argtypes = [ctypes.POINTER(struct_btck_MempoolOptions), ctypes.c_uint32, ctypes.c_int64, ctypes.c_int64, ctypes.c_int64]
+except AttributeError:
+    pass
+try:
+    btck_mempool_options_set_require_standard = BITCOINKERNEL_LIB.btck_mempool_options_set_require_standard
+    btck_mempool_options_set_require_standard.restype = None
+    btck_mempool_options_set_require_standard.argtypes = [ctypes.POINTER(struct_btck_MempoolOptions), ctypes.c_int32]
+except AttributeError:
+    pass
+try:
+    btck_mempool_options_destroy = BITCOINKERNEL_LIB.btck_mempool_options_destroy
+    btck_mempool_options_destroy.restype = None
+    btck_mempool_options_destroy.argtypes = [ctypes.POINTER(struct_btck_MempoolOptions)]
+except AttributeError:
+    pass
+btck_MempoolAcceptResult = ctypes.c_ubyte
+try:
+    btck_mempool_accept_transaction = BITCOINKERNEL_LIB.btck_mempool_accept_transaction
+    btck_mempool_accept_transaction.restype = btck_MempoolAcceptResult
+    btck_mempool_accept_transaction.argtypes = [ctypes.POINTER(struct_btck_Mempool), ctypes.POINTER(struct_btck_Transaction), ctypes.c_int32, btck_WriteBytes, ctypes.POINTER(None)]
+except AttributeError:
+    pass
+try:
+    btck_mempool_accept_package = BITCOINKERNEL_LIB.btck_mempool_accept_package
+    btck_mempool_accept_package.restype = ctypes.c_int32
+    btck_mempool_accept_package.argtypes = [ctypes.POINTER(struct_btck_Mempool), ctypes.POINTER(ctypes.POINTER(struct_btck_Transaction)), size_t, ctypes.c_int32, ctypes.POINTER(ctypes.c_ubyte), btck_WriteBytes, ctypes.POINTER(None)]
+except AttributeError:
+    pass
+try:
+    btck_mempool_count_transactions = BITCOINKERNEL_LIB.btck_mempool_count_transactions
+    btck_mempool_count_transactions.restype = size_t
+    btck_mempool_count_transactions.argtypes = [ctypes.POINTER(struct_btck_Mempool)]
+except AttributeError:
+    pass
+try:
+    btck_mempool_get_usage = BITCOINKERNEL_LIB.btck_mempool_get_usage
+    btck_mempool_get_usage.restype = size_t
+    btck_mempool_get_usage.argtypes = [ctypes.POINTER(struct_btck_Mempool)]
+except AttributeError:
+    pass
+try:
+    btck_mempool_contains = BITCOINKERNEL_LIB.btck_mempool_contains
+    btck_mempool_contains.restype = ctypes.c_int32
+    btck_mempool_contains.argtypes = [ctypes.POINTER(struct_btck_Mempool), ctypes.POINTER(struct_btck_Txid)]
+except AttributeError:
+    pass
 try:
     btck_chain_get_height = BITCOINKERNEL_LIB.btck_chain_get_height
     btck_chain_get_height.restype = int32_t
@@ -794,6 +1163,42 @@ try:
     btck_chain_contains.argtypes = [ctypes.POINTER(struct_btck_Chain), ctypes.POINTER(struct_btck_BlockTreeEntry)]
 except AttributeError:
     pass
+try:
+    btck_chain_snapshot_create = BITCOINKERNEL_LIB.btck_chain_snapshot_create
+    btck_chain_snapshot_create.restype = ctypes.POINTER(struct_btck_ChainSnapshot)
+    btck_chain_snapshot_create.argtypes = [ctypes.POINTER(struct_btck_Chain)]
+except AttributeError:
+    pass
+try:
+    btck_chain_snapshot_get_height = BITCOINKERNEL_LIB.btck_chain_snapshot_get_height
+    btck_chain_snapshot_get_height.restype = int32_t
+    btck_chain_snapshot_get_height.argtypes = [ctypes.POINTER(struct_btck_ChainSnapshot)]
+except AttributeError:
+    pass
+try:
+    btck_chain_snapshot_get_by_height = BITCOINKERNEL_LIB.btck_chain_snapshot_get_by_height
+    btck_chain_snapshot_get_by_height.restype = ctypes.POINTER(struct_btck_BlockTreeEntry)
+    btck_chain_snapshot_get_by_height.argtypes = [ctypes.POINTER(struct_btck_ChainSnapshot), int32_t]
+except AttributeError:
+    pass
+try:
+    btck_chain_snapshot_get_range = BITCOINKERNEL_LIB.btck_chain_snapshot_get_range
+    btck_chain_snapshot_get_range.restype = size_t
+    btck_chain_snapshot_get_range.argtypes = [ctypes.POINTER(struct_btck_ChainSnapshot), int32_t, int32_t, ctypes.POINTER(ctypes.POINTER(struct_btck_BlockTreeEntry))]
+except AttributeError:
+    pass
+try:
+    btck_chain_snapshot_contains = BITCOINKERNEL_LIB.btck_chain_snapshot_contains
+    btck_chain_snapshot_contains.restype = ctypes.c_int32
+    btck_chain_snapshot_contains.argtypes = [ctypes.POINTER(struct_btck_ChainSnapshot), ctypes.POINTER(struct_btck_BlockTreeEntry)]
+except AttributeError:
+    pass
+try:
+    btck_chain_snapshot_destroy = BITCOINKERNEL_LIB.btck_chain_snapshot_destroy
+    btck_chain_snapshot_destroy.restype = None
+    btck_chain_snapshot_destroy.argtypes = [ctypes.POINTER(struct_btck_ChainSnapshot)]
+except AttributeError:
+    pass
 try:
     btck_block_spent_outputs_read = BITCOINKERNEL_LIB.btck_block_spent_outputs_read
     btck_block_spent_outputs_read.restype = ctypes.POINTER(struct_btck_BlockSpentOutputs)
@@ -872,6 +1277,12 @@ try:
     btck_transaction_input_destroy.argtypes = [ctypes.POINTER(struct_btck_TransactionInput)]
 except AttributeError:
     pass
+try:
+    btck_transaction_out_point_create = BITCOINKERNEL_LIB.btck_transaction_out_point_create
+    btck_transaction_out_point_create.restype = ctypes.POINTER(struct_btck_TransactionOutPoint)
+    btck_transaction_out_point_create.argtypes = [ctypes.POINTER(struct_btck_Txid), uint32_t]
+except AttributeError:
+    pass
 try:
     btck_transaction_out_point_copy = BITCOINKERNEL_LIB.btck_transaction_out_point_copy
     btck_transaction_out_point_copy.restype = ctypes.POINTER(struct_btck_TransactionOutPoint)
@@ -896,6 +1307,12 @@ try:
     btck_transaction_out_point_destroy.argtypes = [ctypes.POINTER(struct_btck_TransactionOutPoint)]
 except AttributeError:
     pass
+try:
+    btck_txid_create = BITCOINKERNEL_LIB.btck_txid_create
+    btck_txid_create.restype = ctypes.POINTER(struct_btck_Txid)
+    btck_txid_create.argtypes = [ctypes.c_ubyte * 32]
+except AttributeError:
+    pass
 try:
     btck_txid_copy = BITCOINKERNEL_LIB.btck_txid_copy
     btck_txid_copy.restype = ctypes.POINTER(struct_btck_Txid)
@@ -950,6 +1367,103 @@ try:
     btck_coin_destroy.argtypes = [ctypes.POINTER(struct_btck_Coin)]
 except AttributeError:
     pass
+try:
+    btck_coins_cursor_create = BITCOINKERNEL_LIB.btck_coins_cursor_create
+    btck_coins_cursor_create.restype = ctypes.POINTER(struct_btck_CoinsCursor)
+    btck_coins_cursor_create.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), uint32_t, uint32_t]
+except AttributeError:
+    pass
+try:
+    btck_coins_cursor_get_best_block_hash = BITCOINKERNEL_LIB.btck_coins_cursor_get_best_block_hash
+    btck_coins_cursor_get_best_block_hash.restype = ctypes.POINTER(struct_btck_BlockHash)
+    btck_coins_cursor_get_best_block_hash.argtypes = [ctypes.POINTER(struct_btck_CoinsCursor)]
+except AttributeError:
+    pass
+try:
+    btck_coins_cursor_next_batch = BITCOINKERNEL_LIB.btck_coins_cursor_next_batch
+    btck_coins_cursor_next_batch.restype = ctypes.c_int32
+    btck_coins_cursor_next_batch.argtypes = [ctypes.POINTER(struct_btck_CoinsCursor), size_t, ctypes.POINTER(ctypes.POINTER(struct_btck_TransactionOutPoint)), ctypes.POINTER(ctypes.POINTER(struct_btck_Coin)), ctypes.POINTER(ctypes.c_size_t)]
+except AttributeError:
+    pass
+try:
+    btck_coins_cursor_destroy = BITCOINKERNEL_LIB.btck_coins_cursor_destroy
+    btck_coins_cursor_destroy.restype = None
+    btck_coins_cursor_destroy.argtypes = [ctypes.POINTER(struct_btck_CoinsCursor)]
+except AttributeError:
+    pass
+btck_UtxoHashType = ctypes.c_ubyte
+try:
+    btck_chainstate_manager_get_utxo_stats = BITCOINKERNEL_LIB.btck_chainstate_manager_get_utxo_stats
+    btck_chainstate_manager_get_utxo_stats.restype = ctypes.POINTER(struct_btck_UtxoStats)
+    btck_chainstate_manager_get_utxo_stats.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), btck_UtxoHashType, ctypes.c_int32, btck_UtxoStatsProgress, ctypes.POINTER(None)]
+except AttributeError:
+    pass
+try:
+    btck_utxo_stats_get_height = BITCOINKERNEL_LIB.btck_utxo_stats_get_height
+    btck_utxo_stats_get_height.restype = int32_t
+    btck_utxo_stats_get_height.argtypes = [ctypes.POINTER(struct_btck_UtxoStats)]
+except AttributeError:
+    pass
+try:
+    btck_utxo_stats_get_block_hash = BITCOINKERNEL_LIB.btck_utxo_stats_get_block_hash
+    btck_utxo_stats_get_block_hash.restype = ctypes.POINTER(struct_btck_BlockHash)
+    btck_utxo_stats_get_block_hash.argtypes = [ctypes.POINTER(struct_btck_UtxoStats)]
+except AttributeError:
+    pass
+try:
+    btck_utxo_stats_get_transaction_count = BITCOINKERNEL_LIB.btck_utxo_stats_get_transaction_count
+    btck_utxo_stats_get_transaction_count.restype = ctypes.c_uint64
+    btck_utxo_stats_get_transaction_count.argtypes = [ctypes.POINTER(struct_btck_UtxoStats)]
+except AttributeError:
+    pass
+try:
+    btck_utxo_stats_get_coins_count = BITCOINKERNEL_LIB.btck_utxo_stats_get_coins_count
+    btck_utxo_stats_get_coins_count.restype = ctypes.c_uint64
+    btck_utxo_stats_get_coins_count.argtypes = [ctypes.POINTER(struct_btck_UtxoStats)]
+except AttributeError:
+    pass
+try:
+    btck_utxo_stats_get_total_amount = BITCOINKERNEL_LIB.btck_utxo_stats_get_total_amount
+    btck_utxo_stats_get_total_amount.restype = ctypes.c_int32
+    btck_utxo_stats_get_total_amount.argtypes = [ctypes.POINTER(struct_btck_UtxoStats), ctypes.POINTER(ctypes.c_int64)]
+except AttributeError:
+    pass
+try:
+    btck_utxo_stats_get_bogo_size = BITCOINKERNEL_LIB.btck_utxo_stats_get_bogo_size
+    btck_utxo_stats_get_bogo_size.restype = ctypes.c_uint64
+    btck_utxo_stats_get_bogo_size.argtypes = [ctypes.POINTER(struct_btck_UtxoStats)]
+except AttributeError:
+    pass
+try:
+    btck_utxo_stats_get_hash = BITCOINKERNEL_LIB.btck_utxo_stats_get_hash
+    btck_utxo_stats_get_hash.restype = None
+    btck_utxo_stats_get_hash.argtypes = [ctypes.POINTER(struct_btck_UtxoStats), ctypes.c_ubyte * 32]
+except AttributeError:
+    pass
+try:
+    btck_utxo_stats_destroy = BITCOINKERNEL_LIB.btck_utxo_stats_destroy
+    btck_utxo_stats_destroy.restype = None
+    btck_utxo_stats_destroy.argtypes = [ctypes.POINTER(struct_btck_UtxoStats)]
+except AttributeError:
+    pass
+try:
+    btck_block_range_reader_create = BITCOINKERNEL_LIB.btck_block_range_reader_create
+    btck_block_range_reader_create.restype = ctypes.POINTER(struct_btck_BlockRangeReader)
+    btck_block_range_reader_create.argtypes = [ctypes.POINTER(struct_btck_ChainstateManager), ctypes.POINTER(ctypes.POINTER(struct_btck_BlockTreeEntry)), size_t, ctypes.c_int32, size_t, ctypes.c_int32]
+except AttributeError:
+    pass
+try:
+    btck_block_range_reader_next = BITCOINKERNEL_LIB.btck_block_range_reader_next
+    btck_block_range_reader_next.restype = ctypes.c_int32
+    btck_block_range_reader_next.argtypes = [ctypes.POINTER(struct_btck_BlockRangeReader), ctypes.POINTER(ctypes.POINTER(struct_btck_Block)), ctypes.POINTER(ctypes.POINTER(struct_btck_BlockSpentOutputs))]
+except AttributeError:
+    pass
+try:
+    btck_block_range_reader_destroy = BITCOINKERNEL_LIB.btck_block_range_reader_destroy
+    btck_block_range_reader_destroy.restype = None
+    btck_block_range_reader_destroy.argtypes = [ctypes.POINTER(struct_btck_BlockRangeReader)]
+except AttributeError:
+    pass
 try:
     btck_block_hash_create = BITCOINKERNEL_LIB.btck_block_hash_create
     btck_block_hash_create.restype = ctypes.POINTER(struct_btck_BlockHash)
@@ -1041,30 +1555,42 @@ try:
 except AttributeError:
     pass
 __all__ = \
-    ['btck_Block', 'btck_BlockCheckFlags', 'btck_BlockHash',
-    'btck_BlockHeader', 'btck_BlockSpentOutputs',
-    'btck_BlockTreeEntry', 'btck_BlockValidationResult',
-    'btck_BlockValidationState', 'btck_Chain', 'btck_ChainParameters',
+    ['btck_Block', 'btck_BlockCheckFlags', 'btck_BlockColumn',
+    'btck_BlockColumns', 'btck_BlockHash', 'btck_BlockHeader',
+    'btck_BlockProcessed', 'btck_BlockRangeReader',
+    'btck_BlockSpentOutputs', 'btck_BlockTreeEntry',
+    'btck_BlockValidationResult', 'btck_BlockValidationState',
+    'btck_Chain', 'btck_ChainParameters', 'btck_ChainSnapshot',
     'btck_ChainType', 'btck_ChainstateManager',
-    'btck_ChainstateManagerOptions', 'btck_Coin',
+    'btck_ChainstateManagerOptions', 'btck_Coin', 'btck_CoinsCursor',
     'btck_ConsensusParams', 'btck_Context', 'btck_ContextOptions',
-    'btck_DestroyCallback', 'btck_LogCallback', 'btck_LogCategory',
-    'btck_LogLevel', 'btck_LoggingConnection', 'btck_LoggingOptions',
-    'btck_NotificationInterfaceCallbacks', 'btck_NotifyBlockTip',
-    'btck_NotifyFatalError', 'btck_NotifyFlushError',
-    'btck_NotifyHeaderTip', 'btck_NotifyProgress',
-    'btck_NotifyWarningSet', 'btck_NotifyWarningUnset',
-    'btck_PrecomputedTransactionData', 'btck_ScriptPubkey',
+    'btck_DestroyCallback', 'btck_ImportProgress', 'btck_LogCallback',
+    'btck_LogCategory', 'btck_LogLevel', 'btck_LoggingConnection',
+    'btck_LoggingOptions', 'btck_Mempool', 'btck_MempoolAcceptResult',
+    'btck_MempoolOptions', 'btck_NotificationInterfaceCallbacks',
+    'btck_NotifyBlockTip', 'btck_NotifyFatalError',
+    'btck_NotifyFlushError', 'btck_NotifyHeaderTip',
+    'btck_NotifyProgress', 'btck_NotifyWarningSet',
+    'btck_NotifyWarningUnset', 'btck_PrecomputedTransactionData',
+    'btck_ReadBytes', 'btck_ScriptCheckQueue', 'btck_ScriptPubkey',
     'btck_ScriptVerificationFlags', 'btck_ScriptVerifyStatus',
-    'btck_SynchronizationState', 'btck_Transaction',
-    'btck_TransactionInput', 'btck_TransactionOutPoint',
-    'btck_TransactionOutput', 'btck_TransactionSpentOutputs',
-    'btck_Txid', 'btck_ValidationInterfaceBlockChecked',
+    'btck_SignatureCache', 'btck_SynchronizationState',
+    'btck_Transaction', 'btck_TransactionInput',
+    'btck_TransactionOutPoint', 'btck_TransactionOutput',
+    'btck_TransactionSpentOutputs', 'btck_Txid', 'btck_UtxoHashType',
+    'btck_UtxoStats', 'btck_UtxoStatsProgress',
+    'btck_ValidationInterfaceBlockChecked',
     'btck_ValidationInterfaceBlockConnected',
     'btck_ValidationInterfaceBlockDisconnected',
+    'btck_ValidationInterfaceBorrowedBlockChecked',
+    'btck_ValidationInterfaceBorrowedBlockConnected',
+    'btck_ValidationInterfaceBorrowedBlockDisconnected',
+    'btck_ValidationInterfaceBorrowedPoWValidBlock',
     'btck_ValidationInterfaceCallbacks',
     'btck_ValidationInterfacePoWValidBlock', 'btck_ValidationMode',
-    'btck_Warning', 'btck_WriteBytes', 'btck_block_check',
+    'btck_ValidationQueueOverflow', 'btck_Warning', 'btck_WriteBytes',
+    'btck_block_check', 'btck_block_columns_create',
+    'btck_block_columns_destroy', 'btck_block_columns_get',
     'btck_block_copy', 'btck_block_count_transactions',
     'btck_block_create', 'btck_block_destroy', 'btck_block_get_hash',
     'btck_block_get_header', 'btck_block_get_transaction_at',
@@ -1076,59 +1602,108 @@ __all__ = \
     'btck_block_header_get_nonce', 'btck_block_header_get_prev_hash',
     'btck_block_header_get_timestamp',
     'btck_block_header_get_version', 'btck_block_header_to_bytes',
-    'btck_block_read', 'btck_block_spent_outputs_copy',
+    'btck_block_range_reader_create',
+    'btck_block_range_reader_destroy', 'btck_block_range_reader_next',
+    'btck_block_read', 'btck_block_read_raw',
+    'btck_block_read_with_spent_outputs',
+    'btck_block_serialized_size', 'btck_block_spent_outputs_copy',
     'btck_block_spent_outputs_count',
     'btck_block_spent_outputs_destroy',
     'btck_block_spent_outputs_get_transaction_spent_outputs_at',
-    'btck_block_spent_outputs_read', 'btck_block_to_bytes',
-    'btck_block_tree_entry_equals',
+    'btck_block_spent_outputs_read', 'btck_block_to_buffer',
+    'btck_block_to_bytes', 'btck_block_tree_entry_equals',
     'btck_block_tree_entry_get_ancestor',
     'btck_block_tree_entry_get_block_hash',
     'btck_block_tree_entry_get_block_header',
     'btck_block_tree_entry_get_height',
     'btck_block_tree_entry_get_previous',
+    'btck_block_tree_entry_has_data',
+    'btck_block_tree_entry_has_undo',
     'btck_block_validation_state_copy',
     'btck_block_validation_state_create',
     'btck_block_validation_state_destroy',
     'btck_block_validation_state_get_block_validation_result',
     'btck_block_validation_state_get_validation_mode',
     'btck_chain_contains', 'btck_chain_get_by_height',
-    'btck_chain_get_height', 'btck_chain_parameters_copy',
+    'btck_chain_get_height', 'btck_chain_parameters_add_assumeutxo',
+    'btck_chain_parameters_copy',
     'btck_chain_parameters_create', 'btck_chain_parameters_destroy',
     'btck_chain_parameters_get_consensus_params',
+    'btck_chain_snapshot_contains', 'btck_chain_snapshot_create',
+    'btck_chain_snapshot_destroy',
+    'btck_chain_snapshot_get_by_height',
+    'btck_chain_snapshot_get_height', 'btck_chain_snapshot_get_range',
+    'btck_chainstate_manager_activate_snapshot',
     'btck_chainstate_manager_create',
     'btck_chainstate_manager_destroy',
+    'btck_chainstate_manager_dump_snapshot',
     'btck_chainstate_manager_get_active_chain',
+    'btck_chainstate_manager_get_background_chain',
+    'btck_chainstate_manager_get_background_target',
     'btck_chainstate_manager_get_best_entry',
     'btck_chainstate_manager_get_block_tree_entry_by_hash',
+    'btck_chainstate_manager_get_coin',
+    'btck_chainstate_manager_get_coins',
+    'btck_chainstate_manager_get_mempool',
+    'btck_chainstate_manager_get_utxo_stats',
     'btck_chainstate_manager_import_blocks',
+    'btck_chainstate_manager_import_blocks_from_stream',
+    'btck_chainstate_manager_import_blocks_parallel',
     'btck_chainstate_manager_options_create',
     'btck_chainstate_manager_options_destroy',
+    'btck_chainstate_manager_options_set_assumed_valid',
+    'btck_chainstate_manager_options_set_cache_sizes',
+    'btck_chainstate_manager_options_set_fast_prune',
+    'btck_chainstate_manager_options_set_mempool',
+    'btck_chainstate_manager_options_set_minimum_chain_work',
+    'btck_chainstate_manager_options_set_prune_target',
+    'btck_chainstate_manager_options_set_total_cache_size',
     'btck_chainstate_manager_options_set_wipe_dbs',
     'btck_chainstate_manager_options_set_worker_threads_num',
     'btck_chainstate_manager_options_update_block_tree_db_in_memory',
     'btck_chainstate_manager_options_update_chainstate_db_in_memory',
     'btck_chainstate_manager_process_block',
     'btck_chainstate_manager_process_block_header',
+    'btck_chainstate_manager_process_block_headers',
+    'btck_chainstate_manager_process_raw_block_headers',
+    'btck_chainstate_manager_prune_to_height',
+    'btck_chainstate_manager_submit_block',
     'btck_coin_confirmation_height', 'btck_coin_copy',
     'btck_coin_destroy', 'btck_coin_get_output',
-    'btck_coin_is_coinbase', 'btck_context_copy',
+    'btck_coin_is_coinbase', 'btck_coins_cursor_create',
+    'btck_coins_cursor_destroy',
+    'btck_coins_cursor_get_best_block_hash',
+    'btck_coins_cursor_next_batch', 'btck_context_copy',
     'btck_context_create', 'btck_context_destroy',
     'btck_context_interrupt', 'btck_context_options_create',
     'btck_context_options_destroy',
     'btck_context_options_set_chainparams',
     'btck_context_options_set_notifications',
+    'btck_context_options_set_tip_notification_limit',
     'btck_context_options_set_validation_interface',
+    'btck_context_options_set_validation_interface_queue',
+    'btck_context_sync_validation_interface_queue',
     'btck_logging_connection_create',
     'btck_logging_connection_destroy', 'btck_logging_disable',
     'btck_logging_disable_category', 'btck_logging_enable_category',
     'btck_logging_set_level_category', 'btck_logging_set_options',
+    'btck_mempool_accept_package', 'btck_mempool_accept_transaction',
+    'btck_mempool_contains', 'btck_mempool_count_transactions',
+    'btck_mempool_get_usage', 'btck_mempool_options_create',
+    'btck_mempool_options_destroy', 'btck_mempool_options_set_expiry',
+    'btck_mempool_options_set_limits',
+    'btck_mempool_options_set_max_size',
+    'btck_mempool_options_set_require_standard',
     'btck_precomputed_transaction_data_copy',
     'btck_precomputed_transaction_data_create',
     'btck_precomputed_transaction_data_destroy',
-    'btck_script_pubkey_copy', 'btck_script_pubkey_create',
-    'btck_script_pubkey_destroy', 'btck_script_pubkey_to_bytes',
-    'btck_script_pubkey_verify', 'btck_transaction_copy',
+    'btck_script_check_queue_create',
+    'btck_script_check_queue_destroy', 'btck_script_pubkey_copy',
+    'btck_script_pubkey_create', 'btck_script_pubkey_destroy',
+    'btck_script_pubkey_to_bytes', 'btck_script_pubkey_verify',
+    'btck_script_pubkey_verify_cached', 'btck_signature_cache_create',
+    'btck_signature_cache_destroy', 'btck_signature_cache_get_hits',
+    'btck_transaction_copy',
     'btck_transaction_count_inputs', 'btck_transaction_count_outputs',
     'btck_transaction_create', 'btck_transaction_destroy',
     'btck_transaction_get_input_at', 'btck_transaction_get_locktime',
@@ -1137,6 +1712,7 @@ __all__ = \
     'btck_transaction_input_get_out_point',
     'btck_transaction_input_get_sequence',
     'btck_transaction_out_point_copy',
+    'btck_transaction_out_point_create',
     'btck_transaction_out_point_destroy',
     'btck_transaction_out_point_get_index',
     'btck_transaction_out_point_get_txid',
@@ -1144,25 +1720,36 @@ __all__ = \
     'btck_transaction_output_destroy',
     'btck_transaction_output_get_amount',
     'btck_transaction_output_get_script_pubkey',
+    'btck_transaction_serialized_size',
     'btck_transaction_spent_outputs_copy',
     'btck_transaction_spent_outputs_count',
     'btck_transaction_spent_outputs_destroy',
     'btck_transaction_spent_outputs_get_coin_at',
-    'btck_transaction_to_bytes', 'btck_txid_copy',
-    'btck_txid_destroy', 'btck_txid_equals', 'btck_txid_to_bytes',
-    'int32_t', 'int64_t', 'size_t', 'struct_btck_Block',
+    'btck_transaction_to_buffer', 'btck_transaction_to_bytes',
+    'btck_transaction_verify_inputs', 'btck_txid_copy',
+    'btck_txid_create', 'btck_txid_destroy', 'btck_txid_equals',
+    'btck_txid_to_bytes', 'btck_utxo_stats_destroy',
+    'btck_utxo_stats_get_block_hash', 'btck_utxo_stats_get_bogo_size',
+    'btck_utxo_stats_get_coins_count', 'btck_utxo_stats_get_hash',
+    'btck_utxo_stats_get_height', 'btck_utxo_stats_get_total_amount',
+    'btck_utxo_stats_get_transaction_count', 'int32_t', 'int64_t',
+    'size_t', 'struct_btck_Block', 'struct_btck_BlockColumns',
     'struct_btck_BlockHash', 'struct_btck_BlockHeader',
-    'struct_btck_BlockSpentOutputs', 'struct_btck_BlockTreeEntry',
-    'struct_btck_BlockValidationState', 'struct_btck_Chain',
-    'struct_btck_ChainParameters', 'struct_btck_ChainstateManager',
+    'struct_btck_BlockRangeReader', 'struct_btck_BlockSpentOutputs',
+    'struct_btck_BlockTreeEntry', 'struct_btck_BlockValidationState',
+    'struct_btck_Chain', 'struct_btck_ChainParameters',
+    'struct_btck_ChainSnapshot', 'struct_btck_ChainstateManager',
     'struct_btck_ChainstateManagerOptions', 'struct_btck_Coin',
-    'struct_btck_ConsensusParams', 'struct_btck_Context',
-    'struct_btck_ContextOptions', 'struct_btck_LoggingConnection',
-    'struct_btck_LoggingOptions',
+    'struct_btck_CoinsCursor', 'struct_btck_ConsensusParams',
+    'struct_btck_Context', 'struct_btck_ContextOptions',
+    'struct_btck_LoggingConnection', 'struct_btck_LoggingOptions',
+    'struct_btck_Mempool', 'struct_btck_MempoolOptions',
     'struct_btck_NotificationInterfaceCallbacks',
     'struct_btck_PrecomputedTransactionData',
-    'struct_btck_ScriptPubkey', 'struct_btck_Transaction',
+    'struct_btck_ScriptCheckQueue', 'struct_btck_ScriptPubkey',
+    'struct_btck_SignatureCache', 'struct_btck_Transaction',
     'struct_btck_TransactionInput', 'struct_btck_TransactionOutPoint',
     'struct_btck_TransactionOutput',
     'struct_btck_TransactionSpentOutputs', 'struct_btck_Txid',
+    'struct_btck_UtxoStats',
     'struct_btck_ValidationInterfaceCallbacks', 'uint32_t']
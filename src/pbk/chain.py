@@ -1,4 +1,7 @@
+import collections.abc
+import concurrent.futures
 import ctypes
+import itertools
 import typing
 from enum import IntEnum
 from pathlib import Path
@@ -12,12 +15,21 @@ from pbk.block import (
     BlockValidationState,
 )
 from pbk.capi import KernelOpaquePtr
+from pbk.mempool import Mempool, MempoolOptions
+from pbk.transaction import Coin, TransactionOutPoint
 from pbk.util.exc import ProcessBlockException, ProcessBlockHeaderException
 from pbk.util.sequence import LazySequence
+from pbk.writer import ByteWriter
 
 if typing.TYPE_CHECKING:
     from pbk import BlockHash, BlockHeader, Context
 
+_BLOCK_HEADER_SIZE = 80
+# Same as the maximum number of headers in a single headers P2P message
+_HEADERS_BATCH_SIZE = 2000
+# Larger values would be silently truncated when passed as a size_t
+_SIZE_MAX = 2 ** (8 * ctypes.sizeof(ctypes.c_size_t)) - 1
+
 
 # TODO: add enum auto-generation or testing to ensure it remains in
 # sync with bitcoinkernel.h
@@ -31,6 +43,14 @@ class ChainType(IntEnum):
     REGTEST = 4  #: Regression test network
 
 
+class UtxoHashType(IntEnum):
+    """Hash to compute over the UTXO set in [UtxoStats][pbk.UtxoStats]."""
+
+    HASH_SERIALIZED = 0  #: SHA256 of the serialized set, as used by assumeutxo
+    MUHASH = 1  #: MuHash3072 of the set, as used by the coinstats index
+    NONE = 2  #: Do not hash the set
+
+
 class ConsensusParams(KernelOpaquePtr):
     """View of the consensus parameters of a chain."""
 
@@ -69,6 +89,42 @@ class ChainParameters(KernelOpaquePtr):
             k.btck_chain_parameters_get_consensus_params(self), self
         )
 
+    def add_assumeutxo(
+        self,
+        height: int,
+        block_hash: "BlockHash",
+        hash_serialized: bytes,
+        chain_tx_count: int,
+    ) -> None:
+        """Allow loading a UTXO snapshot at an additional height.
+
+        Useful for loading snapshots of test chains, e.g. written by
+        [ChainstateManager.dump_snapshot][pbk.ChainstateManager.dump_snapshot],
+        with [ChainstateManager.load_snapshot][pbk.ChainstateManager.load_snapshot].
+
+        Args:
+            height: Height of the snapshot's base block.
+            block_hash: Hash of the snapshot's base block.
+            hash_serialized: The expected `UtxoHashType.HASH_SERIALIZED` hash
+                of the UTXO set at the base block.
+            chain_tx_count: Number of transactions in the chain up to and
+                including the base block.
+
+        Raises:
+            ValueError: If the hash is not 32 bytes long, the height is not
+                positive, or there already is a snapshot at the height or
+                with the base block.
+        """
+        if len(hash_serialized) != 32:
+            raise ValueError(
+                f"hash_serialized must be 32 bytes, got {len(hash_serialized)}"
+            )
+        buf = (ctypes.c_ubyte * 32).from_buffer_copy(hash_serialized)
+        if k.btck_chain_parameters_add_assumeutxo(
+            self, height, block_hash, buf, chain_tx_count
+        ):
+            raise ValueError(f"Invalid or duplicate assumeutxo height {height}")
+
 
 class ChainstateManagerOptions(KernelOpaquePtr):
     """Configuration options for creating a [chainstate manager][pbk.ChainstateManager].
@@ -84,6 +140,10 @@ class ChainstateManagerOptions(KernelOpaquePtr):
     _create_fn = k.btck_chainstate_manager_options_create
     _destroy_fn = k.btck_chainstate_manager_options_destroy
 
+    #: Prune target that only prunes blocks on request, see
+    #: [ChainstateManager.prune_to_height][pbk.ChainstateManager.prune_to_height].
+    PRUNE_TARGET_MANUAL = 2**64 - 1
+
     def __init__(self, context: "Context", datadir: str, blocks_dir: str):
         """Create chainstate manager options.
 
@@ -139,6 +199,134 @@ class ChainstateManagerOptions(KernelOpaquePtr):
         """
         k.btck_chainstate_manager_options_set_worker_threads_num(self, worker_threads)
 
+    def set_cache_bytes(
+        self,
+        total: int | None = None,
+        *,
+        block_tree_db: int | None = None,
+        coins_db: int | None = None,
+        coins: int | None = None,
+    ) -> None:
+        """Configure the amount of memory used for caching.
+
+        Either pass a `total` budget, which is split between the caches the
+        same way Bitcoin Core splits `-dbcache`, or pass all three per-cache
+        sizes. A larger coins cache means fewer flushes to the coins
+        database, at the cost of more memory. Defaults to a total of 450 MiB.
+
+        Args:
+            total: Total number of bytes to use for caching.
+            block_tree_db: Number of bytes for the block tree database cache.
+            coins_db: Number of bytes for the coins database cache.
+            coins: Number of bytes for the in-memory coins cache.
+
+        Raises:
+            ValueError: If both or neither of `total` and the per-cache sizes
+                are passed, if only some per-cache sizes are passed, or if any
+                size is negative or does not fit in a `size_t`.
+        """
+        if total is not None:
+            if (block_tree_db, coins_db, coins) != (None, None, None):
+                raise ValueError("total cannot be combined with per-cache sizes")
+            if not 0 <= total <= _SIZE_MAX:
+                raise ValueError(
+                    f"total must be between 0 and {_SIZE_MAX}, got {total}"
+                )
+            k.btck_chainstate_manager_options_set_total_cache_size(self, total)
+            return
+
+        if block_tree_db is None or coins_db is None or coins is None:
+            raise ValueError(
+                "either total or all of block_tree_db, coins_db and coins must be set"
+            )
+        sizes = (block_tree_db, coins_db, coins)
+        if not all(0 <= size <= _SIZE_MAX for size in sizes):
+            raise ValueError(f"cache sizes must be between 0 and {_SIZE_MAX}")
+        k.btck_chainstate_manager_options_set_cache_sizes(
+            self, block_tree_db, coins_db, coins
+        )
+
+    def set_prune_target(self, prune_target_bytes: int) -> None:
+        """Enable pruning of old block and undo files.
+
+        With a target size, the oldest block files are deleted whenever the
+        block files grow beyond it. With `PRUNE_TARGET_MANUAL`, blocks are only
+        pruned on request through
+        [ChainstateManager.prune_to_height][pbk.ChainstateManager.prune_to_height].
+        The most recent 288 blocks are always kept. Pruning is disabled by
+        default.
+
+        Args:
+            prune_target_bytes: Target size of the block files in bytes, at
+                least 550 MiB. 0 disables pruning.
+
+        Raises:
+            ValueError: If the target is negative or too small.
+        """
+        if prune_target_bytes < 0:
+            raise ValueError(f"Invalid prune target of {prune_target_bytes} bytes")
+        if k.btck_chainstate_manager_options_set_prune_target(self, prune_target_bytes):
+            raise ValueError(f"Invalid prune target of {prune_target_bytes} bytes")
+
+    def set_fast_prune(self, fast_prune: bool) -> None:
+        """Use small block files, so that pruning takes effect on short chains.
+
+        Only intended for testing.
+
+        Args:
+            fast_prune: True to use small block files.
+        """
+        k.btck_chainstate_manager_options_set_fast_prune(self, int(fast_prune))
+
+    def set_assumed_valid(self, block_hash: "BlockHash") -> None:
+        """Override the assumed valid block of the chain parameters.
+
+        Script checks are skipped for the block and its ancestors, as long
+        as it is in the best header chain and buried under at least two
+        weeks worth of work. Useful for speeding up the import of chains
+        that have no assumed valid block by default, such as regtest.
+
+        Args:
+            block_hash: Hash of the block assumed to have valid scripts.
+        """
+        k.btck_chainstate_manager_options_set_assumed_valid(self, block_hash)
+
+    def set_minimum_chain_work(self, minimum_chain_work: int | bytes) -> None:
+        """Override the minimum chain work of the chain parameters.
+
+        The chainstate manager stays in initial block download until the
+        best chain has at least this much work.
+
+        Args:
+            minimum_chain_work: The chain work, either as an integer or as
+                32 little-endian bytes.
+
+        Raises:
+            ValueError: If the chain work is negative, too large, or not
+                32 bytes long.
+        """
+        if isinstance(minimum_chain_work, int):
+            if minimum_chain_work < 0 or minimum_chain_work >= 2**256:
+                raise ValueError(f"Invalid minimum chain work {minimum_chain_work}")
+            minimum_chain_work = minimum_chain_work.to_bytes(32, "little")
+        if len(minimum_chain_work) != 32:
+            raise ValueError(
+                f"Minimum chain work must be 32 bytes, got {len(minimum_chain_work)}"
+            )
+        buf = (ctypes.c_ubyte * 32).from_buffer_copy(minimum_chain_work)
+        k.btck_chainstate_manager_options_set_minimum_chain_work(self, buf)
+
+    def set_mempool(self, mempool_options: MempoolOptions) -> None:
+        """Host a mempool in the chainstate manager created with these options.
+
+        See [ChainstateManager.mempool][pbk.ChainstateManager.mempool].
+
+        Args:
+            mempool_options: Options for the mempool. They are copied, so
+                later changes have no effect.
+        """
+        k.btck_chainstate_manager_options_set_mempool(self, mempool_options)
+
     def update_block_tree_db_in_memory(self, block_tree_db_in_memory: bool) -> None:
         """Configure whether to use an in-memory block tree database.
 
@@ -175,7 +363,8 @@ class BlockTreeEntrySequence(LazySequence[BlockTreeEntry]):
     by height. It supports iteration, length queries, and membership testing.
     The sequence is a view into the chain and reflects the current state. Its
     members and length may change during its lifetime, for example when blocks
-    are added to the chain, or when a reorg happens.
+    are added to the chain, or when a reorg happens. Sequences over a
+    `ChainSnapshot` do not change.
 
     !!! warning
         The chain must not be mutated while iterating over this sequence. For
@@ -183,11 +372,11 @@ class BlockTreeEntrySequence(LazySequence[BlockTreeEntry]):
         the results belong to the same chain.
     """
 
-    def __init__(self, chain: "Chain"):
+    def __init__(self, chain: "Chain | ChainSnapshot"):
         """Create a sequence view of block tree entries.
 
         Args:
-            chain: The chain object to create a sequence view for.
+            chain: The chain or chain snapshot to create a sequence view for.
         """
         self._chain = chain
 
@@ -197,17 +386,23 @@ class BlockTreeEntrySequence(LazySequence[BlockTreeEntry]):
 
     def _get_item(self, index: int) -> BlockTreeEntry:
         """Get the block tree entry at the given height."""
-        return BlockTreeEntry._from_view(
-            k.btck_chain_get_by_height(self._chain, index), self._chain
-        )
+        return self._chain._get_by_height(index)
+
+    def __getitem__(  # type: ignore[override]
+        self, index: int | slice
+    ) -> BlockTreeEntry | collections.abc.Sequence[BlockTreeEntry]:
+        """Get item(s) at index. Contiguous slices are fetched in one call."""
+        if isinstance(index, slice):
+            start, stop, step = index.indices(len(self))
+            if step == 1:
+                return self._chain._get_range(start, stop)
+        return super().__getitem__(index)
 
     def __contains__(self, other: typing.Any) -> bool:
         """Return True if `other` exists in the sequence."""
         if not isinstance(other, BlockTreeEntry):
             return False
-        result = k.btck_chain_contains(self._chain, other)
-        assert result in [0, 1]
-        return bool(result)
+        return self._chain._contains(other)
 
 
 class Chain(KernelOpaquePtr):
@@ -237,6 +432,25 @@ class Chain(KernelOpaquePtr):
         """Get the block tree entry at the given height."""
         return BlockTreeEntry._from_view(k.btck_chain_get_by_height(self, height), self)
 
+    def _get_range(self, start: int, stop: int) -> list[BlockTreeEntry]:
+        """Get the block tree entries in a range of heights."""
+        return [self._get_by_height(height) for height in range(start, stop)]
+
+    def _contains(self, entry: BlockTreeEntry) -> bool:
+        """Return True if the entry is in the chain."""
+        result = k.btck_chain_contains(self, entry)
+        assert result in [0, 1]
+        return bool(result)
+
+    def snapshot(self) -> "ChainSnapshot":
+        """Take a snapshot of the chain in its current state.
+
+        Returns:
+            A copy of the chain that does not change when the chain does.
+            Owned handle.
+        """
+        return ChainSnapshot(self)
+
     @property
     def block_tree_entries(self) -> BlockTreeEntrySequence:
         """Sequence of all block tree entries in the chain.
@@ -256,6 +470,84 @@ class Chain(KernelOpaquePtr):
         return f"<Chain height={self.height}>"
 
 
+class ChainSnapshot(KernelOpaquePtr):
+    """Copy of the active chain taken at a point in time.
+
+    Unlike `Chain`, a snapshot is not affected by new blocks or reorgs, so it
+    gives a consistent view of the chain, also when shared between threads.
+    Looking up block tree entries in a snapshot does not take any locks and
+    does not contend with validation.
+
+    Note:
+        Block tree entries retrieved from a snapshot are no longer guaranteed
+        to be in the active chain.
+    """
+
+    _create_fn = k.btck_chain_snapshot_create
+    _destroy_fn = k.btck_chain_snapshot_destroy
+
+    def __init__(self, chain: Chain):
+        """Create a snapshot of the chain in its current state.
+
+        Args:
+            chain: The chain to take a snapshot of.
+
+        Raises:
+            RuntimeError: If the C constructor fails (propagated from base class).
+        """
+        super().__init__(chain)
+        # The snapshot is only valid as long as the chainstate manager is.
+        self._chain = chain
+        self._height = k.btck_chain_snapshot_get_height(self)
+
+    @property
+    def height(self) -> int:
+        """Height of the chain tip at the time of the snapshot.
+
+        Returns:
+            Height of the chain tip. Genesis block is at height 0.
+        """
+        return self._height
+
+    def _get_by_height(self, height: int) -> BlockTreeEntry:
+        """Get the block tree entry at the given height."""
+        return BlockTreeEntry._from_view(
+            k.btck_chain_snapshot_get_by_height(self, height), self
+        )
+
+    def _get_range(self, start: int, stop: int) -> list[BlockTreeEntry]:
+        """Get the block tree entries in a range of heights in a single call."""
+        if stop <= start:
+            return []
+        entries = (ctypes.POINTER(k.btck_BlockTreeEntry) * (stop - start))()
+        count = k.btck_chain_snapshot_get_range(self, start, stop, entries)
+        return [BlockTreeEntry._from_view(entries[i], self) for i in range(count)]
+
+    def _contains(self, entry: BlockTreeEntry) -> bool:
+        """Return True if the entry is in the snapshot."""
+        result = k.btck_chain_snapshot_contains(self, entry)
+        assert result in [0, 1]
+        return bool(result)
+
+    @property
+    def block_tree_entries(self) -> BlockTreeEntrySequence:
+        """Sequence of all block tree entries in the snapshot.
+
+        Returns:
+            A sequence supporting indexing, slicing and iteration over blocks
+            in the snapshot by height.
+        """
+        return BlockTreeEntrySequence(self)
+
+    def __len__(self) -> int:
+        """Number of blocks in the snapshot."""
+        return self._height + 1
+
+    def __repr__(self) -> str:
+        """Return a string representation of the chain snapshot."""
+        return f"<ChainSnapshot height={self._height}>"
+
+
 class MapBase:
     """Base class for dictionary-like views into chainstate manager data.
 
@@ -329,9 +621,9 @@ class BlockMap(MapBase):
             key: The block tree entry identifying which block to check.
 
         Returns:
-            True if the block can be read from disk, False otherwise.
+            True if the block is stored on disk, False otherwise.
         """
-        return bool(k.btck_block_read(self._chainman, key))
+        return key.has_data
 
     def __getitem__(self, key: BlockTreeEntry) -> Block:
         """Read a block from disk using its block tree entry.
@@ -351,6 +643,61 @@ class BlockMap(MapBase):
         return Block._from_handle(entry)
 
 
+class RawBlockMap(MapBase):
+    """Dictionary-like interface for reading serialized blocks from disk.
+
+    This map returns blocks exactly as they are stored on disk, without
+    deserializing them, using block tree entries as keys.
+    """
+
+    def __contains__(self, key: BlockTreeEntry) -> bool:
+        """Check if a block can be read from disk.
+
+        Args:
+            key: The block tree entry identifying which block to check.
+
+        Returns:
+            True if the block is stored on disk, False otherwise.
+        """
+        return key.has_data
+
+    def __getitem__(self, key: BlockTreeEntry) -> bytes:
+        """Read a serialized block from disk using its block tree entry.
+
+        Args:
+            key: The block tree entry identifying which block to read.
+
+        Returns:
+            The serialized block in consensus format.
+
+        Raises:
+            RuntimeError: If reading the block from disk fails.
+        """
+        return self.read(key)
+
+    def read(self, key: BlockTreeEntry, offset: int = 0, size: int = 0) -> bytes:
+        """Read a byte range of a serialized block from disk.
+
+        Args:
+            key: The block tree entry identifying which block to read.
+            offset: Offset of the first byte to read.
+            size: Number of bytes to read, or 0 to read the whole block.
+
+        Returns:
+            The requested bytes of the serialized block.
+
+        Raises:
+            RuntimeError: If reading the block from disk fails, or the byte
+                range is not within the block.
+        """
+        try:
+            return ByteWriter().write(
+                k.btck_block_read_raw, self._chainman, key, offset, size
+            )
+        except RuntimeError as e:
+            raise RuntimeError(f"Error reading raw Block for {key} from disk") from e
+
+
 class BlockSpentOutputsMap(MapBase):
     """Dictionary-like interface for reading block spent outputs (undo data).
 
@@ -365,12 +712,10 @@ class BlockSpentOutputsMap(MapBase):
                 to check.
 
         Returns:
-            True if the spent outputs can be read from disk, False otherwise.
+            True if the spent outputs are stored on disk, False otherwise.
             Always returns False for the genesis block.
         """
-        if key.height == 0:
-            return False
-        return bool(k.btck_block_spent_outputs_read(self._chainman, key))
+        return key.has_undo
 
     def __getitem__(self, key: BlockTreeEntry) -> BlockSpentOutputs:
         """Read block spent outputs from disk using a block tree entry.
@@ -396,6 +741,86 @@ class BlockSpentOutputsMap(MapBase):
         return BlockSpentOutputs._from_handle(entry)
 
 
+class CoinMap(MapBase):
+    """Dictionary-like interface for looking up unspent outputs in the UTXO set.
+
+    This map looks up coins in the UTXO set of the active chainstate using
+    transaction outpoints as keys. Spent or unknown outputs are not present.
+    """
+
+    def __contains__(self, key: TransactionOutPoint) -> bool:
+        """Check if an outpoint is unspent.
+
+        Args:
+            key: The outpoint to look up.
+
+        Returns:
+            True if the outpoint is in the UTXO set, False otherwise.
+        """
+        coin = k.btck_chainstate_manager_get_coin(self._chainman, key)
+        if not coin:
+            return False
+        k.btck_coin_destroy(coin)
+        return True
+
+    def __getitem__(self, key: TransactionOutPoint) -> Coin:
+        """Look up the coin for an outpoint.
+
+        Args:
+            key: The outpoint to look up.
+
+        Returns:
+            The unspent coin for the outpoint. Owned handle.
+
+        Raises:
+            KeyError: If the outpoint is not in the UTXO set.
+        """
+        coin = k.btck_chainstate_manager_get_coin(self._chainman, key)
+        if not coin:
+            raise KeyError(f"{key!r} not found")
+        return Coin._from_handle(coin)
+
+    def get_many(self, keys: typing.Sequence[TransactionOutPoint]) -> list[Coin | None]:
+        """Look up the coins for a batch of outpoints.
+
+        All lookups are done in a single call into the kernel, which is
+        considerably faster than looking up each outpoint individually.
+
+        Args:
+            keys: The outpoints to look up.
+
+        Returns:
+            For each outpoint, the unspent coin, or None if the outpoint is
+            not in the UTXO set. Owned handle.
+
+        Raises:
+            RuntimeError: If looking up the coins fails.
+        """
+        n = len(keys)
+        out_points = (ctypes.POINTER(k.btck_TransactionOutPoint) * n)(
+            *[key._as_parameter_ for key in keys]
+        )
+        coins = (ctypes.POINTER(k.btck_Coin) * n)()
+        if k.btck_chainstate_manager_get_coins(self._chainman, out_points, n, coins):
+            raise RuntimeError("Error looking up coins")
+        return [Coin._from_handle(coin) if coin else None for coin in coins]
+
+
+def _make_block_processed_callback(
+    submitted: dict[int, "concurrent.futures.Future[bool]"],
+) -> k.btck_BlockProcessed:
+    # Only closes over the pending futures, so that the callback does not keep
+    # the chainstate manager alive.
+    def block_processed(submit_id: int, result: int, new_block: int) -> None:
+        future = submitted.pop(submit_id)
+        if result != 0:
+            future.set_exception(ProcessBlockException(result))
+        else:
+            future.set_result(bool(new_block))
+
+    return k.btck_BlockProcessed(block_processed)
+
+
 class ChainstateManager(KernelOpaquePtr):
     """Central manager for blockchain validation and data retrieval.
 
@@ -439,6 +864,9 @@ class ChainstateManager(KernelOpaquePtr):
         # Kernel stores raw function pointers into ctypes trampolines owned
         # by callback objects reachable only through the Python Context.
         self._context = chain_man_opts._context
+        self._submitted: dict[int, concurrent.futures.Future[bool]] = {}
+        self._submit_ids = itertools.count(1)
+        self._block_processed = _make_block_processed_callback(self._submitted)
 
     @property
     def block_tree_entries(self) -> BlockTreeEntryMap:
@@ -461,6 +889,171 @@ class ChainstateManager(KernelOpaquePtr):
         """
         return Chain._from_view(k.btck_chainstate_manager_get_active_chain(self), self)
 
+    @property
+    def mempool(self) -> Mempool | None:
+        """The mempool hosted by this chainstate manager.
+
+        Returns:
+            The mempool, or None if the chainstate manager was created
+            without [ChainstateManagerOptions.set_mempool][pbk.ChainstateManagerOptions.set_mempool].
+            View into this chainstate manager.
+        """
+        ptr = k.btck_chainstate_manager_get_mempool(self)
+        if not ptr:
+            return None
+        return Mempool._from_view(ptr, self)
+
+    def load_snapshot(self, path: typing.Union[str, Path]) -> BlockTreeEntry:
+        """Load an assumeutxo UTXO snapshot and make it the active chainstate.
+
+        The snapshot is a file as written by the `dumptxoutset` RPC. Its base
+        block must be one of the assumeutxo heights of the chain parameters,
+        see [ChainParameters.add_assumeutxo][pbk.ChainParameters.add_assumeutxo],
+        and its header must already have been processed. Once loaded, the
+        active chain starts at the snapshot's base block, and the previously
+        active chainstate keeps validating blocks up to it in the background.
+        Loading progress is reported through the `progress` notification,
+        which reports 100 percent with an empty title once the snapshot was
+        activated, and 0 percent with an empty title if loading it fails.
+
+        Args:
+            path: Filesystem path to the snapshot file.
+
+        Returns:
+            The block tree entry of the snapshot's base block. View into this
+            chainstate manager.
+
+        Raises:
+            RuntimeError: If the snapshot could not be loaded.
+        """
+        encoded_path = str(path).encode("utf-8")
+        ptr = k.btck_chainstate_manager_activate_snapshot(
+            self, encoded_path, len(encoded_path)
+        )
+        if not ptr:
+            raise RuntimeError(f"Error loading UTXO snapshot from {path}")
+        return BlockTreeEntry._from_view(ptr, self)
+
+    def prune_to_height(self, height: int) -> None:
+        """Delete the block and undo files only holding blocks up to a height.
+
+        Requires pruning to have been enabled with
+        [ChainstateManagerOptions.set_prune_target][pbk.ChainstateManagerOptions.set_prune_target].
+        Blocks within 288 blocks of the tip are kept, even if they are below
+        the height. Whether a block was pruned can be checked with
+        [BlockTreeEntry.has_data][pbk.BlockTreeEntry.has_data].
+
+        Args:
+            height: Height of the last block that may be pruned.
+
+        Raises:
+            ValueError: If the height is not positive.
+            RuntimeError: If pruning is not enabled or fails.
+        """
+        if height < 1:
+            raise ValueError(f"height must be positive, got {height}")
+        if k.btck_chainstate_manager_prune_to_height(self, height):
+            raise RuntimeError(f"Error pruning blocks up to height {height}")
+
+    def dump_snapshot(
+        self, path: typing.Union[str, Path]
+    ) -> tuple[BlockTreeEntry, int]:
+        """Write the UTXO set of the active chainstate to a snapshot file.
+
+        The file can be loaded with
+        [load_snapshot][pbk.ChainstateManager.load_snapshot]. Coins are
+        streamed from the chainstate database, so memory use does not grow
+        with the size of the UTXO set. The file is only moved into place once
+        complete, and writing stops early if the context is interrupted.
+
+        Args:
+            path: Filesystem path to write the snapshot file to.
+
+        Returns:
+            The block tree entry of the snapshot's base block, as a view into
+            this chainstate manager, and the number of coins written.
+
+        Raises:
+            RuntimeError: If the snapshot could not be written.
+        """
+        encoded_path = str(path).encode("utf-8")
+        coins_written = ctypes.c_uint64()
+        ptr = k.btck_chainstate_manager_dump_snapshot(
+            self, encoded_path, len(encoded_path), ctypes.byref(coins_written)
+        )
+        if not ptr:
+            raise RuntimeError(f"Error dumping UTXO snapshot to {path}")
+        return BlockTreeEntry._from_view(ptr, self), coins_written.value
+
+    def get_utxo_stats(
+        self,
+        hash_type: UtxoHashType = UtxoHashType.MUHASH,
+        threads: int = 1,
+        progress: typing.Optional[typing.Callable[[int], None]] = None,
+    ) -> "UtxoStats":
+        """Compute statistics about the UTXO set of the active chainstate.
+
+        The coins cache is flushed to disk and the whole chainstate database
+        is scanned. For `UtxoHashType.MUHASH` and `UtxoHashType.NONE` with
+        more than one thread, the txid space is split into shards that are
+        scanned in parallel, with their MuHashes combined at the end. The
+        serialized hash depends on the order of the coins and is always
+        computed by a single thread. A single thread scans the set the same way
+        as Bitcoin Core's `gettxoutsetinfo`. The scan does not hold the GIL,
+        and stops early if the context is interrupted.
+
+        Args:
+            hash_type: The hash to compute over the UTXO set.
+            threads: Number of threads scanning the UTXO set.
+            progress: Called periodically with the number of coins scanned so
+                far. May be called from different threads, but never
+                concurrently.
+
+        Returns:
+            The UTXO set statistics. Owned handle.
+
+        Raises:
+            ValueError: If threads is not positive.
+            RuntimeError: If the scan fails or is interrupted.
+        """
+        if threads < 1:
+            raise ValueError(f"threads must be positive, got {threads}")
+        callback = (
+            k.btck_UtxoStatsProgress(lambda _, coins: progress(coins))
+            if progress
+            else k.btck_UtxoStatsProgress()
+        )
+        ptr = k.btck_chainstate_manager_get_utxo_stats(
+            self, hash_type, threads, callback, None
+        )
+        if not ptr:
+            raise RuntimeError("Error computing UTXO set statistics")
+        return UtxoStats._from_handle(ptr)
+
+    def get_background_chain(self) -> typing.Optional[Chain]:
+        """Get the chain being validated in the background after loading a snapshot.
+
+        Compare its height to the height of
+        [get_background_target][pbk.ChainstateManager.get_background_target] to
+        track the progress of background validation.
+
+        Returns:
+            The background chain, or None if no snapshot is being validated.
+            View into this chainstate manager.
+        """
+        ptr = k.btck_chainstate_manager_get_background_chain(self)
+        return Chain._from_view(ptr, self) if ptr else None
+
+    def get_background_target(self) -> typing.Optional[BlockTreeEntry]:
+        """Get the block background validation is validating up to.
+
+        Returns:
+            The base block of the loaded snapshot, or None if no snapshot is
+            being validated. View into this chainstate manager.
+        """
+        ptr = k.btck_chainstate_manager_get_background_target(self)
+        return BlockTreeEntry._from_view(ptr, self) if ptr else None
+
     def import_blocks(self, paths: list[Path]) -> bool:
         """Import blocks from block files.
 
@@ -486,6 +1079,133 @@ class ChainstateManager(KernelOpaquePtr):
             len(paths),
         )
 
+    def import_blocks_parallel(
+        self,
+        paths: list[Path],
+        threads: int = 1,
+        progress: typing.Optional[
+            typing.Callable[[int, int, float, float], None]
+        ] = None,
+    ) -> None:
+        """Import blocks from block files through a pipeline.
+
+        Up to two files are scanned for blocks at a time, `threads` threads
+        deserialize the blocks and run the context-free block checks, and
+        the calling thread validates and connects them in order. Blocks may
+        appear in any order across the files, such as in the `blk*.dat`
+        files of another node. Blocks whose parent is not known yet are read
+        again from their file once it is; blocks whose parent is never found
+        are skipped. Unlike
+        [import_blocks][pbk.ChainstateManager.import_blocks], this does not
+        trigger a reindex.
+
+        Args:
+            paths: List of filesystem paths to block files to import.
+            threads: Number of threads deserializing and checking blocks.
+            progress: Called about once a second and once the import is
+                done, with the number of blocks and bytes imported so far,
+                and the average blocks and bytes per second.
+
+        Raises:
+            ValueError: If threads is not positive.
+            RuntimeError: If the import fails or is interrupted.
+        """
+        if threads < 1:
+            raise ValueError(f"threads must be positive, got {threads}")
+        encoded_paths = [str(path).encode("utf-8") for path in paths]
+
+        block_file_paths = (ctypes.c_char_p * len(encoded_paths))()
+        block_file_paths[:] = encoded_paths
+        block_file_paths_lens = (ctypes.c_size_t * len(encoded_paths))()
+        block_file_paths_lens[:] = [len(path) for path in encoded_paths]
+
+        callback = (
+            k.btck_ImportProgress(lambda _, *args: progress(*args))
+            if progress
+            else k.btck_ImportProgress()
+        )
+        if k.btck_chainstate_manager_import_blocks_parallel(
+            self,
+            ctypes.cast(
+                block_file_paths, ctypes.POINTER(ctypes.POINTER(ctypes.c_char))
+            ),
+            block_file_paths_lens,
+            len(paths),
+            threads,
+            callback,
+            None,
+        ):
+            raise RuntimeError("Failed to import blocks")
+
+    def import_blocks_from(
+        self,
+        stream: typing.BinaryIO,
+        threads: int = 1,
+        progress: typing.Optional[
+            typing.Callable[[int, int, float, float], None]
+        ] = None,
+    ) -> None:
+        """Import blocks from a binary stream of block file data.
+
+        The stream has the format of `blk*.dat` files, so the concatenated
+        contents of block files can be piped in directly, e.g. from a
+        decompressor or a download, without writing them to disk first. It
+        is read on a separate thread, and the blocks are imported through
+        the same pipeline as
+        [import_blocks_parallel][pbk.ChainstateManager.import_blocks_parallel].
+        Blocks whose parent is not known yet are held in memory up to a total
+        serialized size of 256 MiB; if blocks do not fit the import fails.
+
+        Args:
+            stream: Binary file-like object to read the block data from,
+                through `readinto` if it has one and `read` otherwise. It
+                must be blocking.
+            threads: Number of threads deserializing and checking blocks.
+            progress: Called about once a second and once the import is
+                done, with the number of blocks and bytes imported so far,
+                and the average blocks and bytes per second.
+
+        Raises:
+            ValueError: If threads is not positive.
+            RuntimeError: If the import fails or is interrupted.
+        """
+        if threads < 1:
+            raise ValueError(f"threads must be positive, got {threads}")
+        read_errors: list[BaseException] = []
+
+        def read(buffer, size, _):
+            try:
+                view = memoryview((ctypes.c_char * size).from_address(buffer))
+                if hasattr(stream, "readinto"):
+                    read_len = stream.readinto(view.cast("B"))
+                else:
+                    data = stream.read(size)
+                    read_len = None if data is None else len(data)
+                    if read_len:
+                        ctypes.memmove(buffer, data, read_len)
+                # Non-blocking streams return None when no data is available
+                # yet, which must not be mistaken for the end of the stream.
+                if read_len is None:
+                    raise BlockingIOError("Non-blocking streams are not supported")
+                return read_len
+            except BaseException as e:
+                read_errors.append(e)
+                return -1
+
+        read_callback = k.btck_ReadBytes(read)
+        progress_callback = (
+            k.btck_ImportProgress(lambda _, *args: progress(*args))
+            if progress
+            else k.btck_ImportProgress()
+        )
+        result = k.btck_chainstate_manager_import_blocks_from_stream(
+            self, read_callback, threads, progress_callback, None
+        )
+        if read_errors:
+            raise RuntimeError("Failed to read from the stream") from read_errors[0]
+        if result:
+            raise RuntimeError("Failed to import blocks")
+
     def process_block(self, block: Block) -> bool:
         """Process and validate the passed in block with the chainstate manager.
 
@@ -511,6 +1231,41 @@ class ChainstateManager(KernelOpaquePtr):
         assert is_new_block.value in [0, 1]
         return bool(is_new_block.value)
 
+    def submit_block(self, block: Block) -> "concurrent.futures.Future[bool]":
+        """Queue a block for processing on a worker thread of the kernel.
+
+        Like [process_block][pbk.ChainstateManager.process_block], but
+        returns right away. Submitted blocks are processed one at a time in
+        submission order, so receiving the next block can overlap with
+        validating the previous ones. Blocks still queued when the
+        chainstate manager is destroyed are processed before it is. The
+        futures' callbacks run on the worker thread, and must not destroy the
+        chainstate manager, which aborts the process.
+
+        Args:
+            block: The block to process.
+
+        Returns:
+            A future resolving to True if the block was not processed and
+            saved to disk before, False otherwise. It fails with a
+            `ProcessBlockException` if processing the block failed. The
+            future cannot be cancelled.
+
+        Raises:
+            RuntimeError: If the block could not be queued, for example
+                because the chainstate manager is being destroyed.
+        """
+        future: concurrent.futures.Future[bool] = concurrent.futures.Future()
+        future.set_running_or_notify_cancel()
+        submit_id = next(self._submit_ids)
+        self._submitted[submit_id] = future
+        if k.btck_chainstate_manager_submit_block(
+            self, block, self._block_processed, submit_id
+        ):
+            del self._submitted[submit_id]
+            raise RuntimeError("Failed to submit block")
+        return future
+
     @property
     def blocks(self) -> BlockMap:
         """Dictionary-like interface for reading blocks from disk.
@@ -520,6 +1275,16 @@ class ChainstateManager(KernelOpaquePtr):
         """
         return BlockMap(self)
 
+    @property
+    def raw_blocks(self) -> RawBlockMap:
+        """Dictionary-like interface for reading serialized blocks from disk.
+
+        Returns:
+            A map that reads blocks as bytes, without deserializing them,
+            using block tree entries as keys.
+        """
+        return RawBlockMap(self)
+
     @property
     def block_spent_outputs(self) -> BlockSpentOutputsMap:
         """Dictionary-like interface for reading block spent outputs (undo data).
@@ -529,6 +1294,16 @@ class ChainstateManager(KernelOpaquePtr):
         """
         return BlockSpentOutputsMap(self)
 
+    @property
+    def coins(self) -> CoinMap:
+        """Dictionary-like interface for looking up unspent outputs.
+
+        Returns:
+            A map that retrieves coins from the UTXO set of the active
+            chainstate using transaction outpoints as keys.
+        """
+        return CoinMap(self)
+
     @property
     def best_entry(self) -> BlockTreeEntry:
         """The BlockTreeEntry whose associated BlockHeader has the most known
@@ -541,6 +1316,65 @@ class ChainstateManager(KernelOpaquePtr):
             k.btck_chainstate_manager_get_best_entry(self), self
         )
 
+    def iter_blocks(
+        self,
+        start: int = 0,
+        stop: int | None = None,
+        prefetch: int = 64,
+        threads: int = 4,
+        with_spent_outputs: bool = False,
+    ) -> "BlockRangeReader":
+        """Iterate over the blocks of the active chain in a range of heights.
+
+        Blocks are read ahead on background threads, see `BlockRangeReader`.
+        The range is resolved against a snapshot of the active chain taken
+        when this is called, in a single lookup.
+
+        Args:
+            start: Height of the first block.
+            stop: Height after the last block, or None to read up to and
+                including the tip.
+            prefetch: Maximum number of blocks to read ahead.
+            threads: Number of threads reading blocks.
+            with_spent_outputs: Whether to yield `(Block, BlockSpentOutputs)`
+                pairs instead of blocks. The spent outputs of the genesis block
+                are empty.
+
+        Returns:
+            An iterator over the blocks in ascending height order.
+        """
+        entries = self.get_active_chain().snapshot().block_tree_entries[start:stop]
+        return BlockRangeReader(self, entries, prefetch, threads, with_spent_outputs)
+
+    def read_block_and_undo(
+        self, entry: BlockTreeEntry
+    ) -> tuple[Block, BlockSpentOutputs]:
+        """Read a block and its spent outputs (undo data) from disk.
+
+        This is cheaper than reading `blocks[entry]` and
+        `block_spent_outputs[entry]` separately. The spent outputs of the
+        genesis block are empty, the same as in `iter_blocks`.
+
+        Args:
+            entry: The block tree entry identifying which block to read.
+
+        Returns:
+            The block and its spent outputs. Owned handles.
+
+        Raises:
+            RuntimeError: If reading the block or its spent outputs from disk
+                fails.
+        """
+        block = ctypes.POINTER(k.btck_Block)()
+        spent_outputs = ctypes.POINTER(k.btck_BlockSpentOutputs)()
+        if k.btck_block_read_with_spent_outputs(
+            self, entry, ctypes.byref(block), ctypes.byref(spent_outputs)
+        ):
+            raise RuntimeError(
+                f"Error reading Block and undo data for {entry} from disk"
+            )
+        return Block._from_handle(block), BlockSpentOutputs._from_handle(spent_outputs)
+
     def process_block_header(self, header: "BlockHeader") -> "BlockValidationState":
         """
         Processes and validates the provided block header.
@@ -552,15 +1386,333 @@ class ChainstateManager(KernelOpaquePtr):
             The result of the block header validation. Owned handle.
 
         Raises:
-            ProcessBlockHeaderException: If processing the block header failed. Duplicate block headers do not throw.
+            ProcessBlockHeaderException: If processing the block header failed, with its
+                validation state. Duplicate block headers do not throw.
         """
         state = BlockValidationState()
         result = k.btck_chainstate_manager_process_block_header(self, header, state)
         if result != 0:
-            raise ProcessBlockHeaderException(result)
+            raise ProcessBlockHeaderException(result, state)
 
         return state
 
+    def process_block_headers(
+        self, headers: "list[BlockHeader] | bytes"
+    ) -> BlockTreeEntry | None:
+        """
+        Processes and validates a run of block headers, in order.
+
+        The headers are passed to the kernel in batches of up to 2000, so
+        the chainstate lock is taken once per batch instead of once per
+        header. Each header must connect to an already known header or to
+        its predecessor in the run.
+
+        Args:
+            headers: block headers to be processed, either as a list or as
+                a contiguous run of serialized 80-byte headers
+
+        Returns:
+            The block tree entry of the last accepted header, or None if
+            there were no headers. View into this chainstate manager.
+
+        Raises:
+            ValueError: If the length of the serialized headers is not a
+                multiple of 80.
+            ProcessBlockHeaderException: If processing a block header failed,
+                with the validation state of the rejected header. Headers
+                preceding the failing one are still accepted. Duplicate block
+                headers do not throw.
+        """
+        if isinstance(headers, bytes):
+            if len(headers) % _BLOCK_HEADER_SIZE != 0:
+                raise ValueError(
+                    f"Length of serialized headers must be a multiple of "
+                    f"{_BLOCK_HEADER_SIZE}"
+                )
+            process_fn = k.btck_chainstate_manager_process_raw_block_headers
+            step = _HEADERS_BATCH_SIZE * _BLOCK_HEADER_SIZE
+            batches = (headers[i : i + step] for i in range(0, len(headers), step))
+        else:
+            process_fn = k.btck_chainstate_manager_process_block_headers
+            batches = (
+                (ctypes.POINTER(k.btck_BlockHeader) * len(batch))(
+                    *[header._as_parameter_ for header in batch]
+                )
+                for batch in (
+                    headers[i : i + _HEADERS_BATCH_SIZE]
+                    for i in range(0, len(headers), _HEADERS_BATCH_SIZE)
+                )
+            )
+
+        last_entry = None
+        for batch in batches:
+            state = BlockValidationState()
+            entry_ptr = ctypes.POINTER(k.btck_BlockTreeEntry)()
+            # len() is the byte length for serialized headers and the header
+            # count for arrays, matching what each C function expects
+            result = process_fn(
+                self, batch, len(batch), state, ctypes.byref(entry_ptr)
+            )
+            if entry_ptr:
+                last_entry = BlockTreeEntry._from_view(entry_ptr, self)
+            if result != 0:
+                raise ProcessBlockHeaderException(result, state)
+
+        return last_entry
+
     def __repr__(self) -> str:
         """Return a string representation of the chainstate manager."""
         return f"<ChainstateManager at {hex(id(self))}>"
+
+
+class CoinsCursor(KernelOpaquePtr):
+    """Cursor over a snapshot of the UTXO set.
+
+    On creation, the coins cache is flushed to disk and the cursor then
+    iterates over a snapshot of the chainstate database, in txid order.
+    Iterating over the cursor yields batches of `(TransactionOutPoint, Coin)`
+    pairs.
+
+    The txid space can be split into a number of shards of roughly equal
+    size, with a cursor visiting only one of them. Reading a batch does not
+    hold the GIL, so cursors over different shards can be consumed from
+    multiple threads to scan the UTXO set in parallel. A single cursor must
+    not be used from multiple threads at the same time.
+
+    Reading from the cursor fails once the chainstate database is closed,
+    which happens when the chainstate manager is destroyed and when the
+    database cache is resized while loading a snapshot.
+    """
+
+    _create_fn = k.btck_coins_cursor_create
+    _destroy_fn = k.btck_coins_cursor_destroy
+
+    def __init__(
+        self,
+        chainman: ChainstateManager,
+        shard_index: int = 0,
+        shard_count: int = 1,
+        batch_size: int = 1024,
+    ):
+        """Create a cursor over the UTXO set of the active chainstate.
+
+        Args:
+            chainman: The chainstate manager to read the UTXO set from.
+            shard_index: Index of the shard to iterate over.
+            shard_count: Number of shards to split the txid space into.
+            batch_size: Number of coins per batch.
+
+        Raises:
+            ValueError: If the shard or batch size is invalid.
+            RuntimeError: If the C constructor fails (propagated from base class).
+        """
+        if shard_count < 1 or not 0 <= shard_index < shard_count:
+            raise ValueError(f"Invalid shard {shard_index} of {shard_count}")
+        if batch_size < 1:
+            raise ValueError(f"batch_size must be positive, got {batch_size}")
+        super().__init__(chainman, shard_index, shard_count)
+        # The kernel cursor must not outlive the chainstate manager.
+        self._chainman = chainman
+        self._batch_size = batch_size
+
+    @property
+    def best_block_hash(self) -> BlockHash:
+        """The hash of the block the UTXO set snapshot corresponds to.
+
+        Returns:
+            The block hash of the chain tip at cursor creation. Owned handle.
+        """
+        return BlockHash._from_handle(k.btck_coins_cursor_get_best_block_hash(self))
+
+    def next_batch(self) -> list[tuple[TransactionOutPoint, Coin]]:
+        """Read the next batch of coins.
+
+        Returns:
+            Up to `batch_size` outpoints and their coins. Only the final batch
+            holds fewer, and an empty list is returned once the cursor is
+            exhausted. Owned handle.
+
+        Raises:
+            RuntimeError: If reading from the chainstate database fails.
+        """
+        out_points = (ctypes.POINTER(k.btck_TransactionOutPoint) * self._batch_size)()
+        coins = (ctypes.POINTER(k.btck_Coin) * self._batch_size)()
+        batch_len = ctypes.c_size_t()
+        if k.btck_coins_cursor_next_batch(
+            self, self._batch_size, out_points, coins, ctypes.byref(batch_len)
+        ):
+            raise RuntimeError("Error reading from coins cursor")
+        return [
+            (
+                TransactionOutPoint._from_handle(out_points[i]),
+                Coin._from_handle(coins[i]),
+            )
+            for i in range(batch_len.value)
+        ]
+
+    def __iter__(self) -> typing.Iterator[list[tuple[TransactionOutPoint, Coin]]]:
+        """Iterate over the remaining batches of coins.
+
+        Yields:
+            Batches of outpoints and their coins, as returned by `next_batch`.
+        """
+        while batch := self.next_batch():
+            yield batch
+
+    def __repr__(self) -> str:
+        """Return a string representation of the coins cursor."""
+        return f"<CoinsCursor at {hex(id(self))}>"
+
+
+class UtxoStats(KernelOpaquePtr):
+    """Statistics about the UTXO set at a specific block.
+
+    Computed with
+    [ChainstateManager.get_utxo_stats][pbk.ChainstateManager.get_utxo_stats].
+    """
+
+    # Non-instantiable, created with ChainstateManager.get_utxo_stats
+    _destroy_fn = k.btck_utxo_stats_destroy
+
+    @property
+    def height(self) -> int:
+        """Height of the block the statistics correspond to."""
+        return k.btck_utxo_stats_get_height(self)
+
+    @property
+    def block_hash(self) -> BlockHash:
+        """Hash of the block the statistics correspond to.
+
+        Returns:
+            The block hash. Owned handle.
+        """
+        return BlockHash._from_handle(k.btck_utxo_stats_get_block_hash(self))
+
+    @property
+    def transaction_count(self) -> int:
+        """Number of transactions with unspent outputs."""
+        return k.btck_utxo_stats_get_transaction_count(self)
+
+    @property
+    def coins_count(self) -> int:
+        """Number of unspent outputs."""
+        return k.btck_utxo_stats_get_coins_count(self)
+
+    @property
+    def total_amount(self) -> int | None:
+        """Total amount of all unspent outputs in satoshis.
+
+        Returns:
+            The total amount, or None if it overflowed.
+        """
+        amount = ctypes.c_int64()
+        if k.btck_utxo_stats_get_total_amount(self, ctypes.byref(amount)):
+            return None
+        return amount.value
+
+    @property
+    def bogo_size(self) -> int:
+        """Database-independent size metric of the UTXO set, in bytes."""
+        return k.btck_utxo_stats_get_bogo_size(self)
+
+    @property
+    def hash(self) -> bytes:
+        """Hash of the UTXO set, all zeros if computed with `UtxoHashType.NONE`."""
+        hash_array = (ctypes.c_ubyte * 32)()
+        k.btck_utxo_stats_get_hash(self, hash_array)
+        return bytes(hash_array)
+
+    def __repr__(self) -> str:
+        """Return a string representation of the UTXO set statistics."""
+        return f"<UtxoStats height={self.height} coins={self.coins_count}>"
+
+
+class BlockRangeReader(KernelOpaquePtr):
+    """Reader for a sequence of blocks that prefetches them from disk.
+
+    Blocks are read and deserialized on background threads, up to a fixed
+    number ahead of the one last returned, and are returned in the order
+    their entries were given in. Iterating over the reader yields the blocks,
+    or `(Block, BlockSpentOutputs)` pairs if the spent outputs are read as
+    well. Waiting for a block does not hold the GIL.
+    """
+
+    _create_fn = k.btck_block_range_reader_create
+    _destroy_fn = k.btck_block_range_reader_destroy
+
+    def __init__(
+        self,
+        chainman: ChainstateManager,
+        entries: typing.Sequence[BlockTreeEntry],
+        prefetch: int = 64,
+        threads: int = 4,
+        with_spent_outputs: bool = False,
+    ):
+        """Create a reader for the blocks of the given block tree entries.
+
+        Args:
+            chainman: The chainstate manager to read the blocks with.
+            entries: The block tree entries of the blocks to read, in the
+                order the blocks should be returned.
+            prefetch: Maximum number of blocks to read ahead.
+            threads: Number of threads reading blocks. Clamped between 1 and
+                `prefetch`.
+            with_spent_outputs: Whether to also read the spent outputs (undo
+                data) of each block. The spent outputs of the genesis block are
+                empty.
+
+        Raises:
+            ValueError: If prefetch is not positive.
+            RuntimeError: If the C constructor fails (propagated from base class).
+        """
+        if prefetch < 1:
+            raise ValueError(f"prefetch must be positive, got {prefetch}")
+        entries_array = (ctypes.POINTER(k.btck_BlockTreeEntry) * len(entries))(
+            *[entry._as_parameter_ for entry in entries]
+        )
+        super().__init__(
+            chainman,
+            entries_array,
+            len(entries),
+            int(with_spent_outputs),
+            prefetch,
+            threads,
+        )
+        # The kernel reader must not outlive the chainstate manager.
+        self._chainman = chainman
+        self._with_spent_outputs = with_spent_outputs
+
+    def __iter__(self) -> "BlockRangeReader":
+        """Return the reader itself, which is its own iterator."""
+        return self
+
+    def __next__(self) -> Block | tuple[Block, BlockSpentOutputs]:
+        """Return the next block.
+
+        Returns:
+            The next block, together with its spent outputs if the reader
+            was created with `with_spent_outputs`. Owned handles.
+
+        Raises:
+            StopIteration: Once all blocks have been returned.
+            RuntimeError: If reading the block from disk failed, or the
+                chainstate manager was destroyed.
+        """
+        block = ctypes.POINTER(k.btck_Block)()
+        spent_outputs = ctypes.POINTER(k.btck_BlockSpentOutputs)()
+        if k.btck_block_range_reader_next(
+            self, ctypes.byref(block), ctypes.byref(spent_outputs)
+        ):
+            raise RuntimeError("Error reading Block from disk")
+        if not block:
+            raise StopIteration
+        if self._with_spent_outputs:
+            return (
+                Block._from_handle(block),
+                BlockSpentOutputs._from_handle(spent_outputs),
+            )
+        return Block._from_handle(block)
+
+    def __repr__(self) -> str:
+        """Return a string representation of the block range reader."""
+        return f"<BlockRangeReader at {hex(id(self))}>"
@@ -1,4 +1,5 @@
 import typing
+from enum import IntEnum
 
 import pbk.capi.bindings as k
 from pbk.capi import KernelOpaquePtr
@@ -9,6 +10,18 @@ if typing.TYPE_CHECKING:
     from pbk.validation import ValidationInterfaceCallbacks
 
 
+# TODO: add enum auto-generation or testing to ensure it remains in
+# sync with bitcoinkernel.h
+class ValidationQueueOverflow(IntEnum):
+    """What happens when a validation callback is issued while the queue is full.
+
+    See [ContextOptions.set_validation_interface_queue][pbk.ContextOptions.set_validation_interface_queue].
+    """
+
+    BLOCK = 0  #: Validation waits for the queue to drain
+    DROP_OLDEST = 1  #: The oldest undelivered callback is dropped
+
+
 class ContextOptions(KernelOpaquePtr):
     """Options for creating a new kernel context.
 
@@ -45,6 +58,38 @@ class ContextOptions(KernelOpaquePtr):
         k.btck_context_options_set_notifications(self, notifications)
         self._notifications = notifications
 
+    def set_tip_notification_limit(
+        self, min_interval: float = 0.0, min_blocks: int = 0
+    ) -> None:
+        """Limit how often the `block_tip` and `header_tip` notifications fire.
+
+        A tip is only delivered once both `min_interval` passed and
+        `min_blocks` were connected since the last delivered tip. Newer tips
+        replace a held back one, so the latest tip is always the one
+        delivered. Tips are delivered right away when the synchronization
+        state changes. Once no newer tip arrived for 100 milliseconds, e.g.
+        because validation went idle, the latest held back tip is delivered
+        from a kernel thread as soon as `min_interval` passed, even if fewer
+        than `min_blocks` were connected. Held back tips are also delivered
+        before a chainstate manager is destroyed.
+        Passing neither limit delivers every tip.
+
+        Args:
+            min_interval: Minimum number of seconds between delivered tips.
+            min_blocks: Minimum height difference between delivered tips.
+
+        Raises:
+            ValueError: If a limit is negative.
+        """
+        if min_interval < 0 or min_blocks < 0:
+            raise ValueError(
+                f"limits must not be negative, got {min_interval} and {min_blocks}"
+            )
+        if k.btck_context_options_set_tip_notification_limit(
+            self, round(min_interval * 1000), min_blocks
+        ):
+            raise ValueError("Invalid tip notification limit")
+
     def set_validation_interface(
         self, interface_callbacks: "ValidationInterfaceCallbacks"
     ) -> None:
@@ -56,6 +101,40 @@ class ContextOptions(KernelOpaquePtr):
         k.btck_context_options_set_validation_interface(self, interface_callbacks)
         self._validation_callbacks = interface_callbacks
 
+    def set_validation_interface_queue(
+        self,
+        capacity: int,
+        overflow: ValidationQueueOverflow = ValidationQueueOverflow.BLOCK,
+    ) -> None:
+        """Deliver validation callbacks on a background thread through a queue.
+
+        By default, validation callbacks run synchronously on the validating
+        thread, so a slow callback stalls validation. With a queue, they are
+        delivered one at a time and in order on a kernel thread instead.
+        With `ValidationQueueOverflow.BLOCK`, validation waits for the queue
+        to drain before connecting more blocks once it holds `capacity`
+        callbacks. With `ValidationQueueOverflow.DROP_OLDEST`, validation
+        never waits and the oldest undelivered callbacks are dropped.
+
+        Use [Context.sync_validation_interface_queue][pbk.Context.sync_validation_interface_queue]
+        to wait for all callbacks to be delivered.
+
+        Args:
+            capacity: Number of validation events the queue holds. This
+                includes events without a registered callback, such as tip
+                updates.
+            overflow: What to do once the queue is full.
+
+        Raises:
+            ValueError: If the capacity is not positive.
+        """
+        if capacity < 1:
+            raise ValueError(f"capacity must be positive, got {capacity}")
+        if k.btck_context_options_set_validation_interface_queue(
+            self, capacity, overflow
+        ):
+            raise ValueError(f"Invalid validation interface queue overflow {overflow}")
+
 
 class Context(KernelOpaquePtr):
     """The kernel context is used to initialize internal state and hold the chain
@@ -98,6 +177,14 @@ class Context(KernelOpaquePtr):
         """
         return k.btck_context_interrupt(self)
 
+    def sync_validation_interface_queue(self) -> None:
+        """Wait until all queued validation callbacks were delivered.
+
+        Returns right away if callbacks are delivered synchronously. Must not
+        be called from a validation callback.
+        """
+        k.btck_context_sync_validation_interface_queue(self)
+
     def __repr__(self) -> str:
         """Return a string representation of the context."""
         return f"<Context at {hex(id(self))}>"
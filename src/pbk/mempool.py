@@ -0,0 +1,209 @@
+import ctypes
+import typing
+from enum import IntEnum
+
+import pbk.capi.bindings as k
+from pbk.capi import KernelOpaquePtr
+from pbk.util.type import UserData
+from pbk.writer import ByteWriter, _py_callback
+
+if typing.TYPE_CHECKING:
+    from pbk.transaction import Transaction, Txid
+
+
+# TODO: add enum auto-generation or testing to ensure it remains in
+# sync with bitcoinkernel.h
+class MempoolAcceptResult(IntEnum):
+    """Result of submitting a transaction to the mempool."""
+
+    VALID = 0  #: Valid, and accepted unless only tested
+    INVALID = 1  #: Invalid
+    MEMPOOL_ENTRY = 2  #: Already in the mempool
+    DIFFERENT_WITNESS = 3  #: Not validated, the mempool holds the same transaction with a different witness
+    UNFINISHED = 4  #: Not validated, because validating the package failed before
+
+
+class TransactionAcceptance(typing.NamedTuple):
+    """Outcome of [Mempool.accept_transaction][pbk.Mempool.accept_transaction]."""
+
+    result: MempoolAcceptResult
+    #: Why the transaction was rejected, empty unless it is invalid.
+    reject_reason: str
+
+
+class PackageAcceptance(typing.NamedTuple):
+    """Outcome of [Mempool.accept_package][pbk.Mempool.accept_package]."""
+
+    valid: bool
+    #: The result for each transaction, in the order they were passed.
+    results: list[MempoolAcceptResult]
+    #: Why the package was rejected, empty if it is valid.
+    reject_reason: str
+
+
+_reject_reason_writer = k.btck_WriteBytes(_py_callback)
+
+
+class MempoolOptions(KernelOpaquePtr):
+    """Options for a mempool hosted by a chainstate manager.
+
+    Defaults to the same options as Bitcoin Core. See
+    [ChainstateManagerOptions.set_mempool][pbk.ChainstateManagerOptions.set_mempool].
+    """
+
+    _create_fn = k.btck_mempool_options_create
+    _destroy_fn = k.btck_mempool_options_destroy
+
+    def __init__(self):
+        """Create mempool options with the default values."""
+        super().__init__()
+
+    def set_max_size(self, max_size_bytes: int) -> None:
+        """Set the maximum memory usage of the mempool.
+
+        Once it is exceeded, the transactions with the lowest fee rate are
+        evicted, and the minimum fee rate for accepting new transactions
+        rises. The size must be large enough to hold a cluster of the
+        maximum cluster size, otherwise creating the chainstate manager fails.
+
+        Args:
+            max_size_bytes: Maximum memory usage in bytes.
+
+        Raises:
+            ValueError: If the size is negative.
+        """
+        if k.btck_mempool_options_set_max_size(self, max_size_bytes):
+            raise ValueError(f"max_size_bytes must not be negative, got {max_size_bytes}")
+
+    def set_expiry(self, expiry_seconds: int) -> None:
+        """Set how long unconfirmed transactions are kept in the mempool.
+
+        Args:
+            expiry_seconds: Number of seconds after which transactions expire.
+
+        Raises:
+            ValueError: If the expiry is negative.
+        """
+        if k.btck_mempool_options_set_expiry(self, expiry_seconds):
+            raise ValueError(f"expiry_seconds must not be negative, got {expiry_seconds}")
+
+    def set_limits(
+        self,
+        cluster_count: int,
+        cluster_size_vbytes: int,
+        ancestor_count: int,
+        descendant_count: int,
+    ) -> None:
+        """Set the package limits transactions must stay within to be accepted.
+
+        Args:
+            cluster_count: Maximum number of transactions in a cluster.
+            cluster_size_vbytes: Maximum size of a cluster in virtual bytes.
+            ancestor_count: Maximum number of transactions in a package of a
+                transaction and its ancestors.
+            descendant_count: Maximum number of transactions in a package of
+                a transaction and its descendants.
+
+        Raises:
+            ValueError: If a limit is not positive.
+        """
+        if k.btck_mempool_options_set_limits(
+            self, cluster_count, cluster_size_vbytes, ancestor_count, descendant_count
+        ):
+            raise ValueError("mempool limits must be positive")
+
+    def set_require_standard(self, require_standard: bool) -> None:
+        """Set whether transactions must be standard to be accepted.
+
+        Args:
+            require_standard: Whether non-standard transactions are rejected.
+        """
+        k.btck_mempool_options_set_require_standard(self, require_standard)
+
+
+class Mempool(KernelOpaquePtr):
+    """Unconfirmed transactions validated against the active chainstate.
+
+    The mempool is hosted by a chainstate manager, see
+    [ChainstateManager.mempool][pbk.ChainstateManager.mempool].
+    Transactions are removed once a block confirming them is connected, and
+    the transactions with the lowest fee rate are evicted once the mempool
+    exceeds its maximum size.
+
+    The mempool can be safely used from multiple threads.
+    """
+
+    def accept_transaction(
+        self, transaction: "Transaction", test_accept: bool = False
+    ) -> TransactionAcceptance:
+        """Validate a transaction and add it to the mempool if it is valid.
+
+        Adding it may evict other transactions to stay within the mempool's
+        maximum size.
+
+        Args:
+            transaction: The transaction to validate.
+            test_accept: If True, the transaction is only validated and not
+                added.
+
+        Returns:
+            The result, and why the transaction was rejected.
+        """
+        writer = ByteWriter()
+        result = k.btck_mempool_accept_transaction(
+            self, transaction, test_accept, _reject_reason_writer, UserData(writer)
+        )
+        return TransactionAcceptance(
+            MempoolAcceptResult(result), writer.buffer.decode("utf-8")
+        )
+
+    def accept_package(
+        self, transactions: typing.Sequence["Transaction"], test_accept: bool = False
+    ) -> PackageAcceptance:
+        """Validate transactions together and add them to the mempool if valid.
+
+        Validating them together lets a child pay for parents whose fee rate
+        is too low on their own. Unless only tested, the package must consist
+        of a child and its unconfirmed parents, sorted topologically.
+
+        Args:
+            transactions: The package's transactions.
+            test_accept: If True, the transactions are only validated and not
+                added.
+
+        Returns:
+            Whether the package is valid, the result for each transaction,
+            and why the package was rejected.
+
+        Raises:
+            ValueError: If the package is empty.
+        """
+        n = len(transactions)
+        if n == 0:
+            raise ValueError("package must contain at least one transaction")
+        txs = (ctypes.POINTER(k.btck_Transaction) * n)(
+            *(tx._as_parameter_ for tx in transactions)
+        )
+        results = (ctypes.c_ubyte * n)()
+        writer = ByteWriter()
+        ret = k.btck_mempool_accept_package(
+            self, txs, n, test_accept, results, _reject_reason_writer, UserData(writer)
+        )
+        return PackageAcceptance(
+            ret == 0,
+            [MempoolAcceptResult(result) for result in results],
+            writer.buffer.decode("utf-8"),
+        )
+
+    @property
+    def usage(self) -> int:
+        """Memory usage of the mempool in bytes, bounded by its maximum size."""
+        return k.btck_mempool_get_usage(self)
+
+    def __len__(self) -> int:
+        """Number of transactions in the mempool."""
+        return k.btck_mempool_count_transactions(self)
+
+    def __contains__(self, txid: "Txid") -> bool:
+        """Whether the transaction with the given txid is in the mempool."""
+        return bool(k.btck_mempool_contains(self, txid))
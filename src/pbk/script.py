@@ -55,6 +55,9 @@ class ScriptVerifyStatus(IntEnum):
     ERROR_SPENT_OUTPUTS_REQUIRED = (
         2  #: The taproot flag requires valid spent outputs to be provided
     )
+    ERROR_SPENT_OUTPUTS_MISMATCH = (
+        3  #: The number of spent outputs does not match the number of inputs
+    )
 
 
 class ScriptVerifyException(KernelException):
@@ -113,6 +116,73 @@ class PrecomputedTransactionData(KernelOpaquePtr):
         super().__init__(tx_to, spent_outputs_array, spent_outputs_len)
 
 
+class ScriptCheckQueue(KernelOpaquePtr):
+    """Pool of worker threads for verifying transaction inputs in parallel.
+
+    The calling thread always participates in verification, so the total
+    parallelism is one more than the number of worker threads. Only one
+    verification can use the pool at a time, concurrent verifications wait for
+    their turn.
+    """
+
+    _create_fn = k.btck_script_check_queue_create
+    _destroy_fn = k.btck_script_check_queue_destroy
+
+    def __init__(self, worker_threads: int):
+        """Create a script check queue.
+
+        Args:
+            worker_threads: Number of worker threads to spawn. Clamped
+                between 0 and 15.
+
+        Raises:
+            RuntimeError: If the C constructor fails (propagated from base class).
+        """
+        super().__init__(worker_threads)
+
+
+class SignatureCache(KernelOpaquePtr):
+    """Cache of previously verified signatures and transactions.
+
+    Passing the same cache to repeated verification calls skips the
+    signature checks, or for whole transactions all script checks, that
+    already succeeded. A cache can be shared between threads.
+    """
+
+    _create_fn = k.btck_signature_cache_create
+    _destroy_fn = k.btck_signature_cache_destroy
+
+    def __init__(
+        self,
+        signature_cache_bytes: int = 16 << 20,
+        script_execution_cache_bytes: int = 16 << 20,
+    ):
+        """Create a signature cache.
+
+        Args:
+            signature_cache_bytes: Maximum memory used for caching valid
+                signatures.
+            script_execution_cache_bytes: Maximum memory used for caching
+                fully verified transactions.
+
+        Raises:
+            RuntimeError: If the C constructor fails (propagated from base class).
+        """
+        super().__init__(signature_cache_bytes, script_execution_cache_bytes)
+
+    @property
+    def hits(self) -> int:
+        """The number of verifications answered from this cache.
+
+        Counts both signatures found in the signature cache and
+        transactions found in the script execution cache.
+
+        Returns:
+            The number of cache hits since the cache was created.
+        """
+        return k.btck_signature_cache_get_hits(self)
+
+
 class ScriptPubkey(KernelOpaquePtr):
     """A Bitcoin script defining spending conditions for an output."""
 
@@ -161,6 +231,7 @@ class ScriptPubkey(KernelOpaquePtr):
         precomputed_txdata: PrecomputedTransactionData | None,
         input_index: int,
         flags: ScriptVerificationFlags,
+        signature_cache: SignatureCache | None = None,
     ) -> bool:
         """Verify that a transaction input correctly spends this script pubkey.
 
@@ -179,6 +250,8 @@ class ScriptPubkey(KernelOpaquePtr):
                 spending the script pubkey.
             flags: Bitfield of ScriptFlags controlling which validation rules to
                 enforce. Use ScriptFlags values combined with bitwise OR.
+            signature_cache: If provided, valid signatures are looked up in
+                and added to this cache.
 
         Returns:
             True if the script verification succeeds.
@@ -188,15 +261,27 @@ class ScriptPubkey(KernelOpaquePtr):
                 contains a status code indicating the specific failure reason.
         """
         k_status = k.btck_ScriptVerifyStatus(ScriptVerifyStatus.OK)
-        success = k.btck_script_pubkey_verify(
-            self,
-            amount,
-            tx_to,
-            precomputed_txdata,
-            ctypes.c_uint32(input_index),
-            flags,
-            k_status,
-        )
+        if signature_cache is None:
+            success = k.btck_script_pubkey_verify(
+                self,
+                amount,
+                tx_to,
+                precomputed_txdata,
+                ctypes.c_uint32(input_index),
+                flags,
+                k_status,
+            )
+        else:
+            success = k.btck_script_pubkey_verify_cached(
+                self,
+                amount,
+                tx_to,
+                precomputed_txdata,
+                ctypes.c_uint32(input_index),
+                flags,
+                signature_cache,
+                k_status,
+            )
 
         status = ScriptVerifyStatus(k_status.value)
         if not success and status != ScriptVerifyStatus.OK:
@@ -3,22 +3,42 @@ import typing
 
 import pbk.capi.bindings as k
 from pbk.capi import KernelOpaquePtr
-from pbk.script import ScriptPubkey
+from pbk.script import (
+    ScriptCheckQueue,
+    ScriptPubkey,
+    ScriptVerificationFlags,
+    ScriptVerifyException,
+    ScriptVerifyStatus,
+    SignatureCache,
+)
 from pbk.util.sequence import LazySequence
-from pbk.writer import ByteWriter
+from pbk.writer import write_to_buffer
 
 
 class Txid(KernelOpaquePtr):
-    """Transaction identifier.
-
-    Note:
-        Txid instances cannot be directly constructed. They are obtained from
-        Transaction objects or TransactionOutPoint objects.
-    """
+    """Transaction identifier."""
 
+    _create_fn = k.btck_txid_create
     _destroy_fn = k.btck_txid_destroy
     _copy_fn = k.btck_txid_copy
 
+    def __init__(self, txid: bytes):
+        """Create a txid from raw bytes.
+
+        Args:
+            txid: The 32-byte txid in little-endian byte order.
+
+        Raises:
+            ValueError: If the txid is not exactly 32 bytes.
+            RuntimeError: If the C constructor fails (propagated from base class).
+        """
+        if len(txid) != 32:
+            raise ValueError(
+                f"txid argument must be bytes of length 32, got {len(txid)}"
+            )
+        hash_array = (ctypes.c_ubyte * 32).from_buffer_copy(txid)
+        super().__init__(hash_array)
+
     def __bytes__(self) -> bytes:
         """Serialize the txid to bytes.
 
@@ -71,15 +91,24 @@ class TransactionOutPoint(KernelOpaquePtr):
     A transaction outpoint identifies a specific output by combining a
     transaction ID with an output index. This is used in transaction inputs
     to specify which previous output is being spent.
-
-    Note:
-        TransactionOutPoint instances cannot be directly constructed. They are
-        obtained from TransactionInput objects.
     """
 
+    _create_fn = k.btck_transaction_out_point_create
     _destroy_fn = k.btck_transaction_out_point_destroy
     _copy_fn = k.btck_transaction_out_point_copy
 
+    def __init__(self, txid: Txid, index: int):
+        """Create an outpoint referencing an output of a transaction.
+
+        Args:
+            txid: The txid of the transaction containing the output.
+            index: The zero-based output position within the transaction.
+
+        Raises:
+            RuntimeError: If the C constructor fails (propagated from base class).
+        """
+        super().__init__(txid, index)
+
     @property
     def index(self) -> int:
         """The output index within the transaction.
@@ -312,6 +341,55 @@ class Transaction(KernelOpaquePtr):
         """The nLockTime value of this transaction."""
         return k.btck_transaction_get_locktime(self)
 
+    def verify_inputs(
+        self,
+        spent_outputs: list[TransactionOutput],
+        flags: ScriptVerificationFlags,
+        script_check_queue: ScriptCheckQueue | None = None,
+        signature_cache: SignatureCache | None = None,
+    ) -> list[bool]:
+        """Verify all inputs of this transaction in a single call.
+
+        Args:
+            spent_outputs: The outputs spent by the transaction, in input
+                order.
+            flags: Bitfield of ScriptVerificationFlags controlling which
+                validation rules to enforce.
+            script_check_queue: If provided, the inputs are verified in
+                parallel on its worker threads.
+            signature_cache: If provided, a transaction that was already
+                found valid with the same spent outputs and flags is not
+                verified again.
+
+        Returns:
+            For each input, True if it validly spends its output.
+
+        Raises:
+            ScriptVerifyException: If verification could not be performed.
+                The exception contains a status code indicating the reason.
+        """
+        spent_outputs_array = (
+            ctypes.POINTER(k.btck_TransactionOutput) * len(spent_outputs)
+        )(*[output._as_parameter_ for output in spent_outputs])
+        results = (ctypes.c_int32 * len(self.inputs))()
+        k_status = k.btck_ScriptVerifyStatus(ScriptVerifyStatus.OK)
+        k.btck_transaction_verify_inputs(
+            self,
+            spent_outputs_array,
+            len(spent_outputs),
+            flags,
+            script_check_queue,
+            signature_cache,
+            results,
+            k_status,
+        )
+
+        status = ScriptVerifyStatus(k_status.value)
+        if status != ScriptVerifyStatus.OK:
+            raise ScriptVerifyException(status)
+
+        return [bool(result) for result in results]
+
     def __bytes__(self) -> bytes:
         """Serialize the transaction to bytes.
 
@@ -319,8 +397,11 @@ class Transaction(KernelOpaquePtr):
             The serialized transaction data in consensus format, suitable
             for P2P network transmission.
         """
-        writer = ByteWriter()
-        return writer.write(k.btck_transaction_to_bytes, self)
+        return bytes(
+            write_to_buffer(
+                k.btck_transaction_serialized_size, k.btck_transaction_to_buffer, self
+            )
+        )
 
     def __repr__(self) -> str:
         """Return a string representation of the transaction."""
@@ -1,3 +1,9 @@
+import typing
+
+if typing.TYPE_CHECKING:
+    from pbk.block import BlockValidationState
+
+
 class KernelException(Exception):
     """Base class for errors emitted by this library."""
 
@@ -20,11 +26,14 @@ class ProcessBlockException(KernelException):
 class ProcessBlockHeaderException(KernelException):
     """Raised when ChainstateManager fails to process a block header."""
 
-    def __init__(self, code: int):
+    def __init__(self, code: int, state: "BlockValidationState | None" = None):
         """Create a block header processing exception.
 
         Args:
             code: The error code returned by the C API.
+            state: The validation state of the rejected header, telling why
+                it was rejected.
         """
         self.code = code
+        self.state = state
         super().__init__(f"Block header processing failed with error code {code}")
@@ -3,6 +3,7 @@ from collections.abc import Callable
 
 import pbk.capi.bindings as k
 import pbk.util.callbacks
+from pbk.capi.base import _REVOKED_PTR
 from pbk.block import (
     Block,
     BlockTreeEntry,
@@ -10,16 +11,35 @@ from pbk.block import (
 )
 
 
-def _wrap_block_and_state(fn: Callable[..., None]) -> Callable[..., None]:
+def _call_with_block(
+    fn: Callable[..., None], block_ptr: ctypes.c_void_p, borrow: bool, arg: object
+) -> None:
+    if not borrow:
+        fn(Block._from_handle(block_ptr), arg)
+        return
+    block = Block._from_view(block_ptr)
+    block._borrowed = borrowed = [block]
+    try:
+        fn(block, arg)
+    finally:
+        # The kernel may free the borrowed block once the callback returns,
+        # so the block and the views into it must no longer be used.
+        for obj in borrowed:
+            obj._as_parameter_ = _REVOKED_PTR
+
+
+def _wrap_block_and_state(fn: Callable[..., None], borrow: bool) -> Callable[..., None]:
     def wrapper(block_ptr: ctypes.c_void_p, state_ptr: ctypes.c_void_p) -> None:
-        fn(Block._from_handle(block_ptr), BlockValidationState._from_view(state_ptr))
+        _call_with_block(
+            fn, block_ptr, borrow, BlockValidationState._from_view(state_ptr)
+        )
 
     return wrapper
 
 
-def _wrap_block_and_entry(fn: Callable[..., None]) -> Callable[..., None]:
+def _wrap_block_and_entry(fn: Callable[..., None], borrow: bool) -> Callable[..., None]:
     def wrapper(block_ptr: ctypes.c_void_p, entry_ptr: ctypes.c_void_p) -> None:
-        fn(Block._from_handle(block_ptr), BlockTreeEntry._from_view(entry_ptr))
+        _call_with_block(fn, block_ptr, borrow, BlockTreeEntry._from_view(entry_ptr))
 
     return wrapper
 
@@ -37,7 +57,9 @@ class ValidationInterfaceCallbacks(k.btck_ValidationInterfaceCallbacks):
 
     These callbacks allow monitoring of block validation progress and results.
     Callbacks are invoked synchronously during validation and will block further
-    validation execution until they complete, so they should execute quickly.
+    validation execution until they complete, so they should execute quickly,
+    unless they are queued through
+    [ContextOptions.set_validation_interface_queue][pbk.ContextOptions.set_validation_interface_queue].
 
     All callbacks are optional; only those passed as keyword arguments are
     registered, and any unspecified event is silently ignored.
@@ -54,7 +76,12 @@ class ValidationInterfaceCallbacks(k.btck_ValidationInterfaceCallbacks):
         a block was disconnected during a reorg.
 
     `block` is owned by the callback; `entry` is a view into the kernel's
-    block index and remains valid for the kernel's lifetime.
+    block index and remains valid for the kernel's lifetime. With
+    `borrow_blocks=True`, `block` is instead borrowed from the kernel and only
+    valid for the duration of the callback, which avoids copying every block.
+    Call `block.detach()` to turn it into an owned block in place. Using the
+    borrowed block or views into it, such as its transactions, after the
+    callback returns raises a `ctypes.ArgumentError`.
 
     Example:
         Register only `block_disconnected`:
@@ -66,11 +93,15 @@ class ValidationInterfaceCallbacks(k.btck_ValidationInterfaceCallbacks):
 
     def __init__(
         self,
+        *,
+        borrow_blocks: bool = False,
         **callbacks: Callable[..., None],
     ):
         """Create validation interface callbacks.
 
         Args:
+            borrow_blocks: Pass blocks that are only valid for the duration of
+                the callback, instead of a copy.
             **callbacks: Callback functions for validation events, keyed by callback name
                          (e.g. ``block_disconnected=my_fn``). All are optional; omitted
                          callbacks are left unset.
@@ -79,13 +110,16 @@ class ValidationInterfaceCallbacks(k.btck_ValidationInterfaceCallbacks):
             ValueError: If an unknown callback name is passed.
         """
         super().__init__()
-        wrapped = {
-            name: _VALIDATION_CALLBACK_WRAPPERS[name](fn)
-            if name in _VALIDATION_CALLBACK_WRAPPERS
-            else fn
-            for name, fn in callbacks.items()
-        }
-        pbk.util.callbacks._initialize_callbacks(self, **wrapped)
+        borrowed = [name for name in callbacks if name.startswith("borrowed_")]
+        if borrowed:
+            raise ValueError(f"Callbacks {set(borrowed)} are not recognized")
+        # Borrowed blocks are passed to the separate borrowed_* callbacks
+        wrapped = {}
+        for name, wrap in _VALIDATION_CALLBACK_WRAPPERS.items():
+            if name in callbacks:
+                field = f"borrowed_{name}" if borrow_blocks else name
+                wrapped[field] = wrap(callbacks.pop(name), borrow_blocks)
+        pbk.util.callbacks._initialize_callbacks(self, **wrapped, **callbacks)
 
 
 default_validation_callbacks = ValidationInterfaceCallbacks(
@@ -31,12 +31,18 @@ class ByteWriter:
         self.buffer = bytearray()
         self.exception = None
 
-    def write(self, to_bytes_func: Callable, obj: KernelOpaquePtr) -> bytes:
-        """Serialize a kernel object to bytes using the provided C function."""
+    def write(
+        self, to_bytes_func: Callable, *args: KernelOpaquePtr | int
+    ) -> bytes:
+        """Serialize a kernel object to bytes using the provided C function.
+
+        The arguments are passed to the C function ahead of the writer
+        callback and its user data.
+        """
         self.buffer.clear()
         self.exception = None
 
-        ret = to_bytes_func(obj, k.btck_WriteBytes(_py_callback), UserData(self))
+        ret = to_bytes_func(*args, k.btck_WriteBytes(_py_callback), UserData(self))
 
         if ret != 0:
             if self.exception:
@@ -45,3 +51,30 @@ class ByteWriter:
                 f"C serialization function failed with return code {ret}"
             )
         return bytes(self.buffer)
+
+
+def write_to_buffer(
+    size_func: Callable, to_buffer_func: Callable, obj: KernelOpaquePtr
+) -> bytearray:
+    """Serialize a kernel object with a single C call.
+
+    The object is serialized straight into the returned buffer, without
+    calling back into Python for every serialized field.
+
+    Args:
+        size_func: C function returning the serialized size of the object.
+        to_buffer_func: C function serializing the object into a buffer.
+        obj: The kernel object to serialize.
+
+    Returns:
+        The serialized object.
+
+    Raises:
+        RuntimeError: If serialization fails.
+    """
+    size = size_func(obj)
+    data = bytearray(size)
+    ret = to_buffer_func(obj, (ctypes.c_char * size).from_buffer(data), size)
+    if ret != 0:
+        raise RuntimeError(f"C serialization function failed with return code {ret}")
+    return data
@@ -1,5 +1,6 @@
+import itertools
 import tempfile
-from collections.abc import Generator
+from collections.abc import Callable, Generator, Iterable
 from pathlib import Path
 
 import pytest
@@ -16,6 +17,50 @@ def temp_dir() -> Generator[Path]:
         dir.cleanup()
 
 
+@pytest.fixture(scope="session")
+def regtest_raw_blocks() -> list[bytes]:
+    """The serialized regtest blocks after genesis, in height order."""
+    blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+    return [bytes.fromhex(line) for line in blocks_path.read_text().split()]
+
+
+@pytest.fixture
+def regtest_blocks(regtest_raw_blocks: list[bytes]) -> list[pbk.Block]:
+    """The regtest blocks after genesis, in height order."""
+    return [pbk.Block(raw_block) for raw_block in regtest_raw_blocks]
+
+
+@pytest.fixture
+def make_chainman(temp_dir: Path) -> Callable[..., pbk.ChainstateManager]:
+    """Factory for chainstate managers, each in a new data directory.
+
+    The factory takes the context to use, a regtest context by default, a
+    function to further configure the `ChainstateManagerOptions` with, and
+    blocks to process before returning the chainstate manager.
+    """
+    counter = itertools.count()
+
+    def make(
+        context: pbk.Context | None = None,
+        configure: Callable[[pbk.ChainstateManagerOptions], None] | None = None,
+        blocks: Iterable[pbk.Block] = (),
+    ) -> pbk.ChainstateManager:
+        data_dir = temp_dir / f"chainman{next(counter)}"
+        if context is None:
+            context = pbk.make_context()
+        chain_man_opts = pbk.ChainstateManagerOptions(
+            context, str(data_dir), str(data_dir / "blocks")
+        )
+        if configure:
+            configure(chain_man_opts)
+        chain_man = pbk.ChainstateManager(chain_man_opts)
+        for block in blocks:
+            assert chain_man.process_block(block)
+        return chain_man
+
+    return make
+
+
 @pytest.fixture
 def chainman_regtest(temp_dir: Path) -> pbk.ChainstateManager:
     chain_man = pbk.load_chainman(temp_dir, pbk.ChainType.REGTEST)
@@ -15,8 +15,6 @@ def test_non_instantiable_classes_raise_type_error() -> None:
         (pbk.BlockSpentOutputs, "BlockSpentOutputs"),
         (pbk.Chain, "Chain"),
         (pbk.Coin, "Coin"),
-        (pbk.Txid, "Txid"),
-        (pbk.TransactionOutPoint, "TransactionOutPoint"),
         (pbk.TransactionInput, "TransactionInput"),
         (pbk.TransactionSpentOutputs, "TransactionSpentOutputs"),
     ]
@@ -38,6 +36,8 @@ def test_instantiable_classes_work() -> None:
     pbk.BlockHash(b"0" * 32)
     pbk.ScriptPubkey(b"\x00")
     pbk.TransactionOutput(pbk.ScriptPubkey(b"\x00"), 100)
+    pbk.Txid(b"0" * 32)
+    pbk.TransactionOutPoint(pbk.Txid(b"0" * 32), 0)
     pbk.ChainParameters(pbk.ChainType.REGTEST)
     pbk.ContextOptions()
 
@@ -69,6 +69,8 @@ _OWNED_FACTORIES = {
     "ScriptPubkey": lambda: pbk.ScriptPubkey(b"\x00"),
     "TransactionOutput": lambda: pbk.TransactionOutput(pbk.ScriptPubkey(b"\x00"), 1),
     "ChainParameters": lambda: pbk.ChainParameters(pbk.ChainType.REGTEST),
+    "Txid": lambda: pbk.Txid(b"0" * 32),
+    "TransactionOutPoint": lambda: pbk.TransactionOutPoint(pbk.Txid(b"0" * 32), 0),
 }
 
 
@@ -1,4 +1,9 @@
+import ctypes
+from pathlib import Path
+
 import pbk
+import pbk.capi.bindings as k
+from pbk.writer import ByteWriter, write_to_buffer
 
 import pytest
 
@@ -141,6 +146,32 @@ def test_block() -> None:
     assert repr(block) == f"<Block hash={GENESIS_BLOCK_HASH_HEX} txs=1>"
 
 
+def test_block_to_buffer() -> None:
+    blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+    # The last block has transactions with witnesses
+    raw_block = bytes.fromhex(blocks_path.read_text().split()[-1])
+    for raw in (GENESIS_BLOCK_BYTES, raw_block):
+        block = pbk.Block(raw)
+        size = k.btck_block_serialized_size(block)
+        assert size == len(raw)
+        assert bytes(block) == raw
+        assert ByteWriter().write(k.btck_block_to_bytes, block) == raw
+        data = write_to_buffer(
+            k.btck_block_serialized_size, k.btck_block_to_buffer, block
+        )
+        assert isinstance(data, bytearray) and data == raw
+
+        buffer = ctypes.create_string_buffer(size - 1)
+        assert k.btck_block_to_buffer(block, buffer, size - 1) != 0
+
+    with pytest.raises(RuntimeError):
+        write_to_buffer(
+            lambda block: k.btck_block_serialized_size(block) - 1,
+            k.btck_block_to_buffer,
+            block,
+        )
+
+
 def test_block_check() -> None:
     block = pbk.Block(GENESIS_BLOCK_BYTES)
     consensus_params = pbk.ChainParameters(pbk.ChainType.REGTEST).consensus_params
@@ -1,8 +1,16 @@
+import ctypes
+import gc
+import hashlib
+import io
+import threading
+import time
 from pathlib import Path
 
 import pbk
+import pbk.capi.bindings as k
+import pbk.notifications
 import pytest
-from pbk.util.exc import ProcessBlockException
+from pbk.util.exc import ProcessBlockException, ProcessBlockHeaderException
 
 
 def test_chain_type() -> None:
@@ -50,6 +58,403 @@ def test_chainstate_manager_options(temp_dir: Path) -> None:
     pbk.ChainstateManager(chain_man_opts)
 
 
+def test_chainstate_manager_options_cache_bytes(temp_dir: Path) -> None:
+    context = pbk.make_context()
+    chain_man_opts = pbk.ChainstateManagerOptions(
+        context, str(temp_dir), str(temp_dir / "blocks")
+    )
+
+    chain_man_opts.set_cache_bytes(1 << 30)
+    pbk.ChainstateManager(chain_man_opts)
+
+    chain_man_opts.set_cache_bytes(
+        block_tree_db=1 << 20, coins_db=2 << 20, coins=4 << 20
+    )
+    pbk.ChainstateManager(chain_man_opts)
+
+    with pytest.raises(ValueError):
+        chain_man_opts.set_cache_bytes()
+    with pytest.raises(ValueError):
+        chain_man_opts.set_cache_bytes(1 << 30, coins=1 << 20)
+    with pytest.raises(ValueError):
+        chain_man_opts.set_cache_bytes(coins=1 << 20)
+    with pytest.raises(ValueError):
+        chain_man_opts.set_cache_bytes(-1)
+    with pytest.raises(ValueError):
+        chain_man_opts.set_cache_bytes(2**64)
+    with pytest.raises(ValueError):
+        chain_man_opts.set_cache_bytes(block_tree_db=1 << 20, coins_db=2**64, coins=1)
+
+
+def _sha256d(data: bytes) -> bytes:
+    return hashlib.sha256(hashlib.sha256(data).digest()).digest()
+
+
+def _mine_regtest_block(
+    prev: pbk.Block, height: int, timestamp: int | None = None
+) -> pbk.Block:
+    """Mine a block with only a coinbase transaction paying nothing on top of prev.
+
+    The timestamp defaults to one second after the one of prev.
+    """
+    height_bytes = height.to_bytes((height.bit_length() + 8) // 8, "little")
+    script_sig = bytes([len(height_bytes)]) + height_bytes  # BIP34 height push
+    coinbase = (
+        (2).to_bytes(4, "little")
+        + b"\x01"
+        + bytes(32)
+        + b"\xff" * 4
+        + bytes([len(script_sig)])
+        + script_sig
+        + b"\xff" * 4
+        + b"\x01"
+        + bytes(8)
+        + b"\x01\x51"  # OP_TRUE
+        + bytes(4)
+    )
+    header = prev.block_header
+    if timestamp is None:
+        timestamp = int(header.timestamp.timestamp()) + 1
+    # The regtest target is so low that about every other nonce is valid
+    target = 0x7FFFFF << (8 * (0x20 - 3))
+    for nonce in range(1 << 32):
+        raw_header = (
+            (0x20000000).to_bytes(4, "little")
+            + bytes(prev.block_hash)
+            + _sha256d(coinbase)
+            + timestamp.to_bytes(4, "little")
+            + header.bits.to_bytes(4, "little")
+            + nonce.to_bytes(4, "little")
+        )
+        if int.from_bytes(_sha256d(raw_header), "little") <= target:
+            return pbk.Block(raw_header + b"\x01" + coinbase)
+    raise AssertionError("no valid nonce")
+
+
+def test_prune(chainman_regtest: pbk.ChainstateManager, temp_dir: Path) -> None:
+    with pytest.raises(RuntimeError):
+        chainman_regtest.prune_to_height(100)
+
+    context = pbk.make_context()
+    chain_man_opts = pbk.ChainstateManagerOptions(
+        context, str(temp_dir / "pruned"), str(temp_dir / "pruned" / "blocks")
+    )
+    with pytest.raises(ValueError):
+        chain_man_opts.set_prune_target(1 << 20)
+    chain_man_opts.set_prune_target(1 << 30)
+    chain_man_opts.set_prune_target(pbk.ChainstateManagerOptions.PRUNE_TARGET_MANUAL)
+    chain_man_opts.set_fast_prune(True)
+    chain_man = pbk.ChainstateManager(chain_man_opts)
+
+    blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+    with blocks_path.open("r") as file:
+        for line in file.readlines():
+            assert chain_man.process_block(pbk.Block(bytes.fromhex(line)))
+
+    with pytest.raises(ValueError):
+        chain_man.prune_to_height(0)
+    # The regtest chain is shorter than the blocks always kept below the tip
+    chain_man.prune_to_height(100)
+    entries = chain_man.get_active_chain().block_tree_entries
+    assert all(entry.has_data for entry in entries)
+
+    # Extend the chain so that the first block file of 64 KiB, which fast
+    # pruning limits them to, ends more than 288 blocks below the tip
+    block = chain_man.blocks[entries[-1]]
+    for height in range(len(entries), len(entries) + 400):
+        block = _mine_regtest_block(block, height)
+        assert chain_man.process_block(block)
+    blocks_dir = temp_dir / "pruned" / "blocks"
+    assert (blocks_dir / "blk00000.dat").exists()
+
+    # Only whole files are pruned, and blocks within 288 blocks of the tip
+    # are kept even if they are below the height
+    entries = chain_man.get_active_chain().block_tree_entries
+    chain_man.prune_to_height(len(entries))
+    assert not (blocks_dir / "blk00000.dat").exists()
+    assert not (blocks_dir / "rev00000.dat").exists()
+    assert (blocks_dir / "blk00001.dat").exists()
+    assert not entries[1].has_data and not entries[1].has_undo
+    assert all(entry.has_data for entry in entries[-289:])
+    with pytest.raises(RuntimeError):
+        chain_man.blocks[entries[1]]
+    assert chain_man.blocks[entries[-1]].block_hash == entries[-1].block_hash
+
+
+# Values of btck_SynchronizationState
+_INIT_DOWNLOAD = 1
+_POST_INIT = 2
+
+
+def test_assumed_valid(chainman_regtest: pbk.ChainstateManager, temp_dir: Path) -> None:
+    entries = chainman_regtest.get_active_chain().block_tree_entries
+    tip = entries[-1]
+    raw_blocks = [bytes(chainman_regtest.blocks[entry]) for entry in entries[1:]]
+    # A block with a recent timestamp, so that only the minimum chain work
+    # keeps the chainstate manager in initial block download
+    recent_block = _mine_regtest_block(
+        pbk.Block(raw_blocks[-1]), len(entries), int(time.time())
+    )
+    # Headers burying the tip under more than two weeks worth of work, which
+    # counts blocks at the target spacing regardless of their timestamps
+    burying_headers = []
+    block = pbk.Block(raw_blocks[-1])
+    for height in range(len(entries), len(entries) + 2100):
+        block = _mine_regtest_block(block, height)
+        burying_headers.append(bytes(block)[:80])
+
+    messages: list[str] = []
+    log_connection = pbk.LoggingConnection(messages.append)
+    messages.clear()
+
+    def sync(
+        name: str, minimum_chain_work: int, extra_headers: bytes = b""
+    ) -> list[int]:
+        states: list[int] = []
+        opts = pbk.ContextOptions()
+        opts.set_chainparams(pbk.ChainParameters(pbk.ChainType.REGTEST))
+        opts.set_notifications(
+            pbk.notifications.NotificationInterfaceCallbacks(
+                block_tip=lambda state, entry, progress: states.append(state),
+            )
+        )
+        chain_man_opts = pbk.ChainstateManagerOptions(
+            pbk.Context(opts), str(temp_dir / name), str(temp_dir / name / "blocks")
+        )
+        chain_man_opts.set_assumed_valid(tip.block_hash)
+        chain_man_opts.set_minimum_chain_work(minimum_chain_work)
+        chain_man = pbk.ChainstateManager(chain_man_opts)
+
+        # The assumed valid block must be in the best header chain
+        chain_man.process_block_headers(
+            b"".join(raw[:80] for raw in raw_blocks) + extra_headers
+        )
+        for raw_block in raw_blocks:
+            assert chain_man.process_block(pbk.Block(raw_block))
+        best_entry = chain_man.best_entry
+        assert best_entry.get_ancestor(tip.height).block_hash == tip.block_hash
+        assert chain_man.process_block(recent_block)
+        return states
+
+    with pytest.raises(ValueError):
+        pbk.ChainstateManagerOptions(
+            pbk.make_context(), str(temp_dir), str(temp_dir / "blocks")
+        ).set_minimum_chain_work(bytes(31))
+    with pytest.raises(ValueError):
+        pbk.ChainstateManagerOptions(
+            pbk.make_context(), str(temp_dir), str(temp_dir / "blocks")
+        ).set_minimum_chain_work(-1)
+
+    # The chain does not have the minimum work, so it stays in initial block
+    # download, and the assumed valid block's ancestors are still verified
+    states = sync("high_work", 1 << 200)
+    assert set(states) == {_INIT_DOWNLOAD}
+    assert any(
+        "Enabling script verification at block #1" in message
+        and "best header chainwork below minimumchainwork" in message
+        for message in messages
+    )
+
+    messages.clear()
+    states = sync("low_work", 0)
+    assert states[-1] == _POST_INIT
+    # The regtest chain is too short to skip verifying the scripts of the
+    # assumed valid block's ancestors, which must be buried under two weeks
+    # worth of work.
+    assert any(
+        "Enabling script verification at block #1" in message
+        and "block too recent relative to best header" in message
+        for message in messages
+    )
+
+    messages.clear()
+    sync("buried", 0, b"".join(burying_headers))
+    # Buried deep enough, the scripts of the assumed valid block and its
+    # ancestors are not verified
+    assert any("Disabling script verification at block #1 " in m for m in messages)
+    assert not any("Enabling script verification at block #1 " in m for m in messages)
+    del log_connection
+
+
+def test_import_blocks_parallel(
+    chainman_regtest: pbk.ChainstateManager, temp_dir: Path
+) -> None:
+    tip = chainman_regtest.get_active_chain().block_tree_entries[-1]
+
+    # Split the blocks across two files, with the later blocks in the first
+    # file and garbage between blocks, like in a blocks directory.
+    regtest_magic = bytes.fromhex("fabfb5da")
+    blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+    raw_blocks = [bytes.fromhex(line) for line in blocks_path.read_text().split()]
+    block_files = [temp_dir / "blk00000.dat", temp_dir / "blk00001.dat"]
+    for path, chunk in zip(block_files, (raw_blocks[100:], raw_blocks[:100])):
+        with path.open("wb") as file:
+            for raw_block in chunk:
+                file.write(regtest_magic + len(raw_block).to_bytes(4, "little"))
+                file.write(raw_block + b"\x00" * 3)
+
+    context = pbk.make_context()
+    chain_man_opts = pbk.ChainstateManagerOptions(
+        context, str(temp_dir / "import"), str(temp_dir / "import" / "blocks")
+    )
+    chain_man = pbk.ChainstateManager(chain_man_opts)
+
+    with pytest.raises(ValueError):
+        chain_man.import_blocks_parallel(block_files, threads=0)
+
+    reports = []
+    chain_man.import_blocks_parallel(
+        block_files, threads=3, progress=lambda *args: reports.append(args)
+    )
+    assert chain_man.best_entry.block_hash == tip.block_hash
+    assert chain_man.get_active_chain().height == tip.height
+    blocks, size, blocks_per_second, bytes_per_second = reports[-1]
+    assert blocks == len(raw_blocks)
+    assert size == sum(len(raw_block) for raw_block in raw_blocks)
+    assert blocks_per_second > 0 and bytes_per_second > 0
+
+    # Importing the same blocks again imports nothing new
+    reports.clear()
+    chain_man.import_blocks_parallel(
+        block_files, progress=lambda *args: reports.append(args)
+    )
+    assert reports[-1][:2] == (0, 0)
+
+
+def test_import_blocks_from(
+    chainman_regtest: pbk.ChainstateManager, temp_dir: Path
+) -> None:
+    tip = chainman_regtest.get_active_chain().block_tree_entries[-1]
+
+    regtest_magic = bytes.fromhex("fabfb5da")
+    blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+    raw_blocks = [bytes.fromhex(line) for line in blocks_path.read_text().split()]
+    stream = io.BytesIO(
+        b"".join(
+            regtest_magic + len(raw_block).to_bytes(4, "little") + raw_block
+            for raw_block in reversed(raw_blocks)
+        )
+    )
+
+    context = pbk.make_context()
+    chain_man_opts = pbk.ChainstateManagerOptions(
+        context, str(temp_dir / "stream"), str(temp_dir / "stream" / "blocks")
+    )
+    chain_man = pbk.ChainstateManager(chain_man_opts)
+
+    class FailingStream(io.RawIOBase):
+        def readinto(self, buffer):
+            raise OSError("broken pipe")
+
+    with pytest.raises(RuntimeError) as exc_info:
+        chain_man.import_blocks_from(FailingStream())
+    assert isinstance(exc_info.value.__cause__, OSError)
+
+    class NonBlockingStream(io.RawIOBase):
+        def readinto(self, buffer):
+            return None
+
+    with pytest.raises(RuntimeError) as exc_info:
+        chain_man.import_blocks_from(NonBlockingStream())
+    assert isinstance(exc_info.value.__cause__, BlockingIOError)
+
+    reports = []
+    chain_man.import_blocks_from(
+        stream, threads=2, progress=lambda *args: reports.append(args)
+    )
+    assert chain_man.best_entry.block_hash == tip.block_hash
+    assert reports[-1][0] == len(raw_blocks)
+
+    # Streams without readinto are read through read, which may return
+    # fewer bytes than requested
+    class ReadOnlyStream:
+        def __init__(self, data: bytes):
+            self._stream = io.BytesIO(data)
+
+        def read(self, size: int) -> bytes:
+            return self._stream.read(min(size, 1000))
+
+    chain_man_opts = pbk.ChainstateManagerOptions(
+        context, str(temp_dir / "read"), str(temp_dir / "read" / "blocks")
+    )
+    chain_man = pbk.ChainstateManager(chain_man_opts)
+    chain_man.import_blocks_from(ReadOnlyStream(stream.getvalue()))
+    assert chain_man.best_entry.block_hash == tip.block_hash
+
+
+def test_submit_block(chainman_regtest: pbk.ChainstateManager, temp_dir: Path) -> None:
+    tip = chainman_regtest.get_active_chain().block_tree_entries[-1]
+
+    context = pbk.make_context()
+    chain_man_opts = pbk.ChainstateManagerOptions(
+        context, str(temp_dir / "submit"), str(temp_dir / "submit" / "blocks")
+    )
+    chain_man = pbk.ChainstateManager(chain_man_opts)
+
+    blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+    blocks = [pbk.Block(bytes.fromhex(line)) for line in blocks_path.read_text().split()]
+    futures = [chain_man.submit_block(block) for block in blocks]
+    assert all(future.result(timeout=60) for future in futures)
+    assert not futures[0].cancel()
+    assert chain_man.best_entry.block_hash == tip.block_hash
+
+    # Duplicates are processed but not new
+    assert chain_man.submit_block(blocks[-1]).result(timeout=60) is False
+
+    # A block whose parent is unknown fails
+    mutated = bytearray(bytes(blocks[-1]))
+    mutated[4:36] = bytes(32)
+    future = chain_man.submit_block(pbk.Block(bytes(mutated)))
+    with pytest.raises(ProcessBlockException):
+        future.result(timeout=60)
+
+
+def test_submit_block_during_destroy(temp_dir: Path) -> None:
+    blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+    blocks = [pbk.Block(bytes.fromhex(line)) for line in blocks_path.read_text().split()]
+    resubmit_errors: list[Exception] = []
+
+    # Hold up the worker thread when connecting the first submitted block,
+    # until the chainstate manager is being destroyed
+    destroying = threading.Event()
+
+    def block_tip(state: int, entry: object, progress: float) -> None:
+        if k.btck_block_tree_entry_get_height(entry) == 1:
+            destroying.wait()
+
+    opts = pbk.ContextOptions()
+    opts.set_chainparams(pbk.ChainParameters(pbk.ChainType.REGTEST))
+    opts.set_notifications(
+        pbk.notifications.NotificationInterfaceCallbacks(block_tip=block_tip)
+    )
+    chain_man_opts = pbk.ChainstateManagerOptions(
+        pbk.Context(opts), str(temp_dir), str(temp_dir / "blocks")
+    )
+    # The held worker thread holds cs_main, which destroying kernel objects
+    # left over by other tests may need.
+    gc.collect()
+    gc.disable()
+    try:
+        with pbk.ChainstateManager(chain_man_opts) as chain_man:
+            futures = [chain_man.submit_block(block) for block in blocks]
+
+            def resubmit(_: object) -> None:
+                try:
+                    chain_man.submit_block(blocks[-1])
+                except RuntimeError as e:
+                    resubmit_errors.append(e)
+
+            futures[-1].add_done_callback(resubmit)
+            threading.Timer(0.5, destroying.set).start()
+    finally:
+        gc.enable()
+
+    # Queued blocks were processed, and submitting from a callback while the
+    # queue was drained was rejected instead of deadlocking
+    assert all(future.result(timeout=0) for future in futures)
+    assert len(resubmit_errors) == 1
+
+
 def test_chainstate_manager(chainman_regtest: pbk.ChainstateManager) -> None:
     chain_man = chainman_regtest
     chain = chain_man.get_active_chain()
@@ -63,6 +468,346 @@ def test_chainstate_manager(chainman_regtest: pbk.ChainstateManager) -> None:
     assert pbk.BlockHash(bytes(32)) not in chain_man.block_tree_entries
 
 
+def test_coins(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    tip = chain_man.get_active_chain().block_tree_entries[-1]
+    coinbase = chain_man.blocks[tip].transactions[0]
+
+    unspent = pbk.TransactionOutPoint(coinbase.txid, 0)
+    missing = pbk.TransactionOutPoint(pbk.Txid(bytes(32)), 0)
+
+    assert unspent in chain_man.coins
+    assert missing not in chain_man.coins
+
+    coin = chain_man.coins[unspent]
+    assert coin.is_coinbase
+    assert coin.confirmation_height == tip.height
+    assert coin.output.amount == coinbase.outputs[0].amount
+    with pytest.raises(KeyError):
+        chain_man.coins[missing]
+
+    coins = chain_man.coins.get_many([missing, unspent, missing])
+    assert coins[0] is None and coins[2] is None
+    assert coins[1] is not None
+    assert coins[1].confirmation_height == tip.height
+    assert chain_man.coins.get_many([]) == []
+
+
+def test_coins_cursor(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    tip = chain_man.get_active_chain().block_tree_entries[-1]
+
+    cursor = pbk.CoinsCursor(chain_man, batch_size=16)
+    assert cursor.best_block_hash == tip.block_hash
+    batches = list(cursor)
+    assert all(len(batch) == 16 for batch in batches[:-1])
+    assert 0 < len(batches[-1]) <= 16
+    assert cursor.next_batch() == []
+
+    coins = {
+        (bytes(out_point.txid), out_point.index): coin
+        for batch in batches
+        for out_point, coin in batch
+    }
+    out_point, coin = batches[0][0]
+    assert chain_man.coins[out_point].output.amount == coin.output.amount
+
+    sharded = [
+        (bytes(out_point.txid), out_point.index)
+        for shard_index in range(3)
+        for batch in pbk.CoinsCursor(chain_man, shard_index, 3)
+        for out_point, _ in batch
+    ]
+    assert len(sharded) == len(coins)
+    assert set(sharded) == set(coins)
+
+    with pytest.raises(ValueError):
+        pbk.CoinsCursor(chain_man, 3, 3)
+    with pytest.raises(ValueError):
+        pbk.CoinsCursor(chain_man, batch_size=0)
+
+
+def test_iter_blocks(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    entries = chain_man.get_active_chain().block_tree_entries
+
+    hashes = [block.block_hash for block in chain_man.iter_blocks()]
+    assert hashes == [entry.block_hash for entry in entries]
+
+    blocks = list(chain_man.iter_blocks(200, 203, prefetch=1, threads=8))
+    assert [block.block_hash for block in blocks] == [
+        entry.block_hash for entry in entries[200:203]
+    ]
+    assert list(chain_man.iter_blocks(10, 10)) == []
+
+    reversed_entries = [entries[5], entries[3], entries[4]]
+    reader = pbk.BlockRangeReader(chain_man, reversed_entries, prefetch=2, threads=2)
+    assert [block.block_hash for block in reader] == [
+        entry.block_hash for entry in reversed_entries
+    ]
+    with pytest.raises(StopIteration):
+        next(reader)
+
+    # Readers that are not fully consumed can be destroyed
+    reader = chain_man.iter_blocks(prefetch=4)
+    next(reader)
+    del reader
+
+    with pytest.raises(ValueError):
+        chain_man.iter_blocks(prefetch=0)
+
+
+def test_iter_blocks_destroyed_chainman(temp_dir: Path) -> None:
+    with pbk.load_chainman(temp_dir, pbk.ChainType.REGTEST) as chain_man:
+        blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+        for line in blocks_path.read_text().split():
+            assert chain_man.process_block(pbk.Block(bytes.fromhex(line)))
+        reader = chain_man.iter_blocks(prefetch=8, threads=4)
+        next(reader)
+
+    # The reader's worker threads were stopped before the chainstate manager
+    # was destroyed
+    with pytest.raises(RuntimeError):
+        next(reader)
+    del reader
+
+
+def test_read_block_and_undo(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    entries = chain_man.get_active_chain().block_tree_entries
+
+    block, spent_outputs = chain_man.read_block_and_undo(entries[202])
+    assert block.block_hash == entries[202].block_hash
+    expected = chain_man.block_spent_outputs[entries[202]]
+    assert len(spent_outputs.transactions) == len(expected.transactions)
+    assert len(spent_outputs.transactions) == len(block.transactions) - 1
+
+    # The genesis block has no spent outputs, like in iter_blocks
+    block, spent_outputs = chain_man.read_block_and_undo(entries[0])
+    assert block.block_hash == entries[0].block_hash
+    assert len(spent_outputs.transactions) == 0
+    [(block, spent_outputs)] = chain_man.iter_blocks(0, 1, with_spent_outputs=True)
+    assert block.block_hash == entries[0].block_hash
+    assert len(spent_outputs.transactions) == 0
+
+    pairs = list(chain_man.iter_blocks(200, with_spent_outputs=True))
+    assert len(pairs) == len(entries) - 200
+    for entry, (block, spent_outputs) in zip(entries[200:], pairs):
+        assert block.block_hash == entry.block_hash
+        assert len(spent_outputs.transactions) == len(block.transactions) - 1
+
+
+def test_block_columns(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    entries = chain_man.get_active_chain().block_tree_entries
+
+    block, spent_outputs = chain_man.read_block_and_undo(entries[202])
+    columns = block.to_columns(spent_outputs)
+    txs = list(block.transactions)
+    inputs = [txin for tx in txs for txin in tx.inputs]
+    outputs = [txout for tx in txs for txout in tx.outputs]
+    coins = [coin for tx in spent_outputs.transactions for coin in tx.coins]
+
+    assert bytes(columns.txids) == b"".join(bytes(tx.txid) for tx in txs)
+    assert columns.tx_input_offsets[-1] == len(inputs)
+    assert columns.tx_output_offsets[-1] == len(outputs)
+    for i, tx in enumerate(txs):
+        start, stop = columns.tx_input_offsets[i], columns.tx_input_offsets[i + 1]
+        assert stop - start == len(tx.inputs)
+    assert columns.input_prevout_indices.tolist() == [
+        txin.out_point.index for txin in inputs
+    ]
+    assert bytes(columns.input_prevout_txids[-32:]) == bytes(
+        inputs[-1].out_point.txid
+    )
+    assert columns.output_amounts.tolist() == [txout.amount for txout in outputs]
+    scripts, offsets = columns.output_scripts, columns.output_script_offsets
+    assert [
+        bytes(scripts[offsets[i] : offsets[i + 1]]) for i in range(len(outputs))
+    ] == [bytes(txout.script_pubkey) for txout in outputs]
+
+    # The coinbase input has no spent output
+    n_coinbase_inputs = len(txs[0].inputs)
+    assert columns.spent_amounts.tolist() == [0] * n_coinbase_inputs + [
+        coin.output.amount for coin in coins
+    ]
+    assert columns.spent_heights.tolist()[n_coinbase_inputs:] == [
+        coin.confirmation_height for coin in coins
+    ]
+    assert columns.spent_is_coinbase.tolist()[n_coinbase_inputs:] == [
+        int(coin.is_coinbase) for coin in coins
+    ]
+    scripts, offsets = columns.spent_scripts, columns.spent_script_offsets
+    assert bytes(scripts[offsets[-2] : offsets[-1]]) == bytes(
+        coins[-1].output.script_pubkey
+    )
+
+    columns = block.to_columns()
+    assert len(columns.output_amounts) == len(outputs)
+    assert len(columns.spent_amounts) == 0
+    with pytest.raises(ValueError):
+        chain_man.blocks[entries[201]].to_columns(spent_outputs)
+
+
+def test_utxo_stats(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    tip = chain_man.get_active_chain().block_tree_entries[-1]
+    coins = [coin for batch in pbk.CoinsCursor(chain_man) for _, coin in batch]
+
+    reported = []
+    stats = chain_man.get_utxo_stats(progress=reported.append)
+    assert stats.height == tip.height
+    assert stats.block_hash == tip.block_hash
+    assert stats.coins_count == len(coins)
+    assert 0 < stats.transaction_count <= stats.coins_count
+    assert stats.total_amount == sum(coin.output.amount for coin in coins)
+    assert stats.bogo_size > 0
+    assert stats.hash != bytes(32)
+    assert reported[-1] == len(coins)
+
+    # Sharded MuHashes combine into the hash computed by Bitcoin Core's
+    # single threaded scan
+    for threads in (2, 3, 4):
+        reported.clear()
+        parallel = chain_man.get_utxo_stats(threads=threads, progress=reported.append)
+        assert parallel.hash == stats.hash
+        assert parallel.coins_count == stats.coins_count
+        assert parallel.transaction_count == stats.transaction_count
+        assert parallel.total_amount == stats.total_amount
+        assert parallel.bogo_size == stats.bogo_size
+        assert max(reported) == len(coins)
+
+    serialized = chain_man.get_utxo_stats(pbk.UtxoHashType.HASH_SERIALIZED)
+    assert serialized.coins_count == stats.coins_count
+    assert serialized.hash not in (stats.hash, bytes(32))
+
+    assert chain_man.get_utxo_stats(pbk.UtxoHashType.NONE).hash == bytes(32)
+    none = chain_man.get_utxo_stats(pbk.UtxoHashType.NONE, threads=4)
+    assert none.hash == bytes(32)
+    assert none.coins_count == stats.coins_count
+    with pytest.raises(ValueError):
+        chain_man.get_utxo_stats(threads=0)
+
+
+def test_load_snapshot(
+    chainman_regtest: pbk.ChainstateManager, temp_dir: Path
+) -> None:
+    chain_man = chainman_regtest
+    tip = chain_man.get_active_chain().height
+    assert chain_man.get_background_chain() is None
+    assert chain_man.get_background_target() is None
+
+    with pytest.raises(RuntimeError):
+        chain_man.load_snapshot(temp_dir / "missing.dat")
+
+    snapshot_path = temp_dir / "truncated.dat"
+    snapshot_path.write_bytes(b"utxo\xff")
+    with pytest.raises(RuntimeError):
+        chain_man.load_snapshot(snapshot_path)
+
+    # A failed load leaves the active chainstate untouched
+    assert chain_man.get_active_chain().height == tip
+    assert chain_man.get_background_chain() is None
+
+
+def test_load_snapshot_activates(
+    chainman_regtest: pbk.ChainstateManager, temp_dir: Path
+) -> None:
+    entries = chainman_regtest.get_active_chain().block_tree_entries
+    base = entries[-1]
+    blocks = [chainman_regtest.blocks[entry] for entry in entries[1:]]
+    # Including the genesis block's coinbase
+    chain_tx_count = 1 + sum(len(block.transactions) for block in blocks)
+    snapshot_path = temp_dir / "utxo.dat"
+    chainman_regtest.dump_snapshot(snapshot_path)
+    utxo_hash = chainman_regtest.get_utxo_stats(
+        pbk.UtxoHashType.HASH_SERIALIZED
+    ).hash
+
+    def snapshot_chainman(
+        name: str, hash_serialized: bytes
+    ) -> tuple[pbk.ChainstateManager, list[tuple[str, int]]]:
+        reports: list[tuple[str, int]] = []
+        chain_params = pbk.ChainParameters(pbk.ChainType.REGTEST)
+        chain_params.add_assumeutxo(
+            base.height, base.block_hash, hash_serialized, chain_tx_count
+        )
+        with pytest.raises(ValueError):
+            chain_params.add_assumeutxo(
+                base.height, base.block_hash, hash_serialized, chain_tx_count
+            )
+        opts = pbk.ContextOptions()
+        opts.set_chainparams(chain_params)
+        opts.set_notifications(
+            pbk.notifications.NotificationInterfaceCallbacks(
+                progress=lambda title, title_len, percent, resume_possible: (
+                    reports.append(
+                        (ctypes.string_at(title, title_len).decode(), percent)
+                    )
+                ),
+            )
+        )
+        data_dir = temp_dir / name
+        chain_man = pbk.ChainstateManager(
+            pbk.ChainstateManagerOptions(
+                pbk.Context(opts), str(data_dir), str(data_dir / "blocks")
+            )
+        )
+        chain_man.process_block_headers(b"".join(bytes(b)[:80] for b in blocks))
+        reports.clear()
+        return chain_man, reports
+
+    chain_man, reports = snapshot_chainman("valid", utxo_hash)
+    for block in blocks[:10]:
+        assert chain_man.process_block(block)
+    # Activating the snapshot resizes the cache of the chainstate database
+    # the cursor reads from, which closes and reopens it
+    cursor = pbk.CoinsCursor(chain_man, batch_size=1)
+    assert len(cursor.next_batch()) == 1
+    assert chain_man.load_snapshot(snapshot_path).block_hash == base.block_hash
+    with pytest.raises(RuntimeError):
+        cursor.next_batch()
+    assert chain_man.get_active_chain().height == base.height
+    assert chain_man.get_background_chain().height == 10
+    assert chain_man.get_background_target().block_hash == base.block_hash
+    stats = chain_man.get_utxo_stats(pbk.UtxoHashType.HASH_SERIALIZED)
+    assert stats.hash == utxo_hash
+    # Completion is only reported once the snapshot was validated
+    assert reports[0] == ("Loading UTXO snapshot…", 0)
+    assert reports[-1] == ("", 100)
+    assert ("", 100) not in reports[:-1]
+
+    chain_man, reports = snapshot_chainman("corrupt", bytes(32))
+    with pytest.raises(RuntimeError):
+        chain_man.load_snapshot(snapshot_path)
+    assert chain_man.get_active_chain().height == 0
+    assert chain_man.get_background_chain() is None
+    assert reports[-1] == ("", 0)
+    assert ("", 100) not in reports
+
+
+def test_dump_snapshot(
+    chainman_regtest: pbk.ChainstateManager, temp_dir: Path
+) -> None:
+    chain_man = chainman_regtest
+    tip = chain_man.get_active_chain().block_tree_entries[-1]
+    snapshot_path = temp_dir / "utxo.dat"
+
+    base, coins_written = chain_man.dump_snapshot(snapshot_path)
+    assert base == tip
+    assert coins_written == sum(len(batch) for batch in pbk.CoinsCursor(chain_man))
+    assert not (temp_dir / "utxo.dat.incomplete").exists()
+
+    data = snapshot_path.read_bytes()
+    # Magic, version and network magic precede the base block hash and count
+    assert data[:5] == b"utxo\xff"
+    assert data[11:43] == bytes(tip.block_hash)
+    assert int.from_bytes(data[43:51], "little") == coins_written
+
+    with pytest.raises(RuntimeError):
+        chain_man.dump_snapshot(temp_dir / "missing" / "utxo.dat")
+
+
 def test_process_block(temp_dir: Path) -> None:
     chain_man = pbk.load_chainman(temp_dir, pbk.ChainType.REGTEST)
 
@@ -97,6 +842,46 @@ def test_process_block_header(temp_dir: Path) -> None:
     assert chain_man.best_entry.height == 1
 
 
+def test_process_block_headers(temp_dir: Path) -> None:
+    chain_man = pbk.load_chainman(temp_dir, pbk.ChainType.REGTEST)
+
+    blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+    with open(blocks_path, "r") as f:
+        raw_headers = [bytes.fromhex(line.strip())[:80] for line in f if line.strip()]
+    headers = [pbk.BlockHeader(raw_header) for raw_header in raw_headers[:100]]
+
+    assert chain_man.process_block_headers([]) is None
+    last_entry = chain_man.process_block_headers(headers)
+    assert last_entry is not None
+    assert last_entry.height == 100
+    assert last_entry.block_hash == headers[-1].block_hash
+
+    # Already known headers are accepted again
+    last_entry = chain_man.process_block_headers(b"".join(raw_headers))
+    assert last_entry is not None
+    assert last_entry.height == len(raw_headers)
+    assert chain_man.best_entry == last_entry
+
+    # Only the headers are known, not the blocks
+    assert not last_entry.has_data and not last_entry.has_undo
+    assert last_entry not in chain_man.blocks
+    assert last_entry not in chain_man.raw_blocks
+    assert last_entry not in chain_man.block_spent_outputs
+
+    with pytest.raises(ValueError):
+        chain_man.process_block_headers(raw_headers[0][:79])
+
+    # A header that does not connect to a known header is rejected
+    orphan = bytearray(raw_headers[0])
+    orphan[4] ^= 0xFF  # Flip bits in the previous block hash
+    with pytest.raises(ProcessBlockHeaderException) as excinfo:
+        chain_man.process_block_headers(bytes(orphan))
+    state = excinfo.value.state
+    assert state is not None
+    assert state.validation_mode == pbk.ValidationMode.INVALID
+    assert state.block_validation_result == pbk.BlockValidationResult.MISSING_PREV
+
+
 def test_chain(chainman_regtest: pbk.ChainstateManager) -> None:
     chain_man = chainman_regtest
     chain = chain_man.get_active_chain()
@@ -119,6 +904,45 @@ def test_chain(chainman_regtest: pbk.ChainstateManager) -> None:
     assert repr(chain_man).endswith(">")
 
 
+def test_chain_snapshot(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    chain = chain_man.get_active_chain()
+    snapshot = chain.snapshot()
+
+    assert snapshot.height == chain.height
+    assert len(snapshot) == len(chain)
+    assert repr(snapshot) == "<ChainSnapshot height=206>"
+
+    entries = snapshot.block_tree_entries
+    assert list(entries) == list(chain.block_tree_entries)
+    assert entries[-1] == chain.block_tree_entries[-1]
+    assert entries[10:20] == chain.block_tree_entries[10:20]
+    assert entries[200:300] == chain.block_tree_entries[200:]
+    assert entries[::50] == [entries[height] for height in range(0, 207, 50)]
+    assert entries[5:5] == []
+    with pytest.raises(IndexError):
+        entries[207]
+
+    assert chain.block_tree_entries[100] in entries
+    assert chain_man.best_entry in entries
+
+
+def test_chain_snapshot_is_immutable(temp_dir: Path) -> None:
+    chain_man = pbk.load_chainman(temp_dir, pbk.ChainType.REGTEST)
+    chain = chain_man.get_active_chain()
+    snapshot = chain.snapshot()
+
+    blocks_path = Path(__file__).parent / "data" / "regtest" / "blocks.txt"
+    with open(blocks_path, "r") as f:
+        block_1 = pbk.Block(bytes.fromhex(f.readline()))
+    chain_man.process_block(block_1)
+
+    assert chain.height == 1
+    assert snapshot.height == 0
+    assert chain.block_tree_entries[1] not in snapshot.block_tree_entries
+    assert chain.snapshot().height == 1
+
+
 def test_read_block(chainman_regtest: pbk.ChainstateManager) -> None:
     chain_man = chainman_regtest
     chain = chain_man.get_active_chain()
@@ -133,8 +957,26 @@ def test_read_block(chainman_regtest: pbk.ChainstateManager) -> None:
     assert chain_tip in chain_man.blocks
     assert chain_tip in chain_man.block_spent_outputs
     assert genesis not in chain_man.block_spent_outputs  # genesis has no undo data
+    assert genesis.has_data and not genesis.has_undo
+    assert chain_tip.has_data and chain_tip.has_undo
 
     with pytest.raises(
         KeyError, match="Genesis block does not have BlockSpentOutputs data"
     ):
         chain_man.block_spent_outputs[genesis]
+
+
+def test_read_raw_block(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    chain_tip = chain_man.get_active_chain().block_tree_entries[-1]
+
+    raw_block = chain_man.raw_blocks[chain_tip]
+    assert raw_block == bytes(chain_man.blocks[chain_tip])
+    assert chain_tip in chain_man.raw_blocks
+
+    assert chain_man.raw_blocks.read(chain_tip, 0, 80) == raw_block[:80]
+    assert chain_man.raw_blocks.read(chain_tip, 80, 1) == raw_block[80:81]
+    with pytest.raises(RuntimeError):
+        chain_man.raw_blocks.read(chain_tip, len(raw_block), 1)
+    with pytest.raises(RuntimeError):
+        chain_man.raw_blocks.read(chain_tip, 1)
@@ -0,0 +1,105 @@
+import ctypes
+from collections.abc import Callable
+
+import pytest
+
+import pbk
+import pbk.capi.bindings as k
+
+
+def test_mempool_options() -> None:
+    opts = pbk.MempoolOptions()
+    with pytest.raises(ValueError):
+        opts.set_max_size(-1)
+    with pytest.raises(ValueError):
+        opts.set_expiry(-1)
+    with pytest.raises(ValueError):
+        opts.set_limits(0, 1000, 25, 25)
+    opts.set_require_standard(False)
+
+
+def test_mempool(
+    make_chainman: Callable[..., pbk.ChainstateManager],
+    regtest_blocks: list[pbk.Block],
+) -> None:
+    blocks = regtest_blocks
+    assert make_chainman().mempool is None
+
+    # Block 202 is the first block spending coinbase outputs
+    chainman = make_chainman(
+        configure=lambda opts: opts.set_mempool(pbk.MempoolOptions()),
+        blocks=blocks[:201],
+    )
+    mempool = chainman.mempool
+    assert mempool is not None
+    assert len(mempool) == 0
+
+    coinbase, *txs = blocks[201].transactions
+    result = mempool.accept_transaction(coinbase)
+    assert result == (pbk.MempoolAcceptResult.INVALID, "coinbase")
+
+    assert mempool.accept_transaction(txs[0], test_accept=True) == (
+        pbk.MempoolAcceptResult.VALID,
+        "",
+    )
+    assert len(mempool) == 0
+    with pytest.raises(ValueError):
+        mempool.accept_package([])
+    # The kernel rejects empty packages and null transactions as well
+    null_txs = (ctypes.POINTER(k.btck_Transaction) * 1)()
+    results = (ctypes.c_ubyte * 1)()
+    for n in (0, 1):
+        assert k.btck_mempool_accept_package(
+            mempool, null_txs, n, True, results, k.btck_WriteBytes(), None
+        )
+    package = mempool.accept_package(txs, test_accept=True)
+    assert package.valid
+    assert package.results == [pbk.MempoolAcceptResult.VALID] * len(txs)
+    assert len(mempool) == 0
+
+    for tx in txs:
+        assert mempool.accept_transaction(tx).result == pbk.MempoolAcceptResult.VALID
+    assert len(mempool) == len(txs)
+    assert mempool.usage > 0
+    assert txs[0].txid in mempool
+    assert mempool.accept_transaction(txs[0]) == (
+        pbk.MempoolAcceptResult.INVALID,
+        "txn-already-in-mempool",
+    )
+
+    # Transactions are removed once they are confirmed
+    assert chainman.process_block(blocks[201])
+    assert len(mempool) == 0
+    assert txs[0].txid not in mempool
+
+    package = mempool.accept_package(txs)
+    assert not package.valid
+    assert package.reject_reason
+
+
+def test_mempool_max_size(
+    make_chainman: Callable[..., pbk.ChainstateManager],
+    regtest_blocks: list[pbk.Block],
+) -> None:
+    blocks = regtest_blocks
+    opts = pbk.MempoolOptions()
+    # The maximum size must hold at least 40 clusters of the maximum size
+    opts.set_limits(64, 500, 25, 25)
+    opts.set_max_size(19_999)
+
+    def configure(chain_man_opts: pbk.ChainstateManagerOptions) -> None:
+        chain_man_opts.set_mempool(opts)
+
+    with pytest.raises(RuntimeError):
+        make_chainman(configure=configure)
+
+    opts.set_max_size(20_000)
+    chainman = make_chainman(configure=configure, blocks=blocks[:201])
+    mempool = chainman.mempool
+    assert mempool is not None
+
+    results = [mempool.accept_transaction(tx) for tx in blocks[201].transactions[1:]]
+    rejected = [r for r in results if r.result == pbk.MempoolAcceptResult.INVALID]
+    assert rejected
+    assert rejected[0].reject_reason == "mempool full"
+    assert mempool.usage <= 20_000
@@ -1,7 +1,11 @@
 import ctypes
+import time
+from collections.abc import Callable
 
 import pytest
 
+import pbk
+import pbk.capi.bindings as k
 import pbk.notifications
 
 
@@ -56,3 +60,52 @@ def test_notification_callbacks_swallow_user_data() -> None:
     # user_data void* prepended to the domain args.
     cb.warning_unset(ctypes.c_void_p(), ctypes.c_ubyte(7))
     assert seen == [(1, 7)]
+
+
+def _tip_limited_context(
+    tips: list[int], min_interval: float, min_blocks: int
+) -> pbk.Context:
+    opts = pbk.ContextOptions()
+    opts.set_chainparams(pbk.ChainParameters(pbk.ChainType.REGTEST))
+    opts.set_notifications(
+        pbk.notifications.NotificationInterfaceCallbacks(
+            block_tip=lambda state, entry, progress: tips.append(
+                k.btck_block_tree_entry_get_height(entry)
+            ),
+        )
+    )
+    opts.set_tip_notification_limit(min_interval, min_blocks)
+    return pbk.Context(opts)
+
+
+def test_tip_notification_limit(
+    make_chainman: Callable[..., pbk.ChainstateManager],
+    regtest_blocks: list[pbk.Block],
+) -> None:
+    with pytest.raises(ValueError):
+        pbk.ContextOptions().set_tip_notification_limit(min_blocks=-1)
+
+    blocks = regtest_blocks
+
+    # Genesis is delivered as the first tip, and then every 50 blocks. The
+    # latest tip is delivered once no further block is connected.
+    tips: list[int] = []
+    chainman = make_chainman(_tip_limited_context(tips, 0, 50), blocks=blocks)
+    assert tips[:5] == [0, 50, 100, 150, 200]
+    deadline = time.monotonic() + 10
+    while tips[-1] != len(blocks) and time.monotonic() < deadline:
+        time.sleep(0.01)
+    assert tips == [0, 50, 100, 150, 200, len(blocks)]
+    del chainman
+    assert tips == [0, 50, 100, 150, 200, len(blocks)]
+
+    # Held back tips are delivered once the interval passed
+    tips = []
+    chainman = make_chainman(_tip_limited_context(tips, 0.05, 10**6), blocks=blocks)
+    deadline = time.monotonic() + 10
+    while tips[-1] != len(blocks) and time.monotonic() < deadline:
+        time.sleep(0.01)
+    assert tips[0] == 0
+    assert tips[-1] == len(blocks)
+    assert tips == sorted(tips)
+    assert len(tips) < len(blocks)
@@ -2,6 +2,7 @@
 
 
 import pbk
+import pytest
 
 
 def _test_verify_script(
@@ -67,3 +68,105 @@ def test_invalid_scripts() -> None:
         "010000000001011f97548fbbe7a0db7588a66e18d803d0089315aa7d4cc28360b6ec50ef36718a0100000000ffffffff02df1776000000000017a9146c002a686959067f4866b8fb493ad7970290ab728757d29f0000000000220020701a8d401c84fb13e6baf169d59684e17abd9fa216c8cc5b9fc63d622ff8c58d04004730440220565d170eed95ff95027a69b313758450ba84a01224e1f7f130dda46e94d13f8602207bdd20e307f062594022f12ed5017bbf4a055a06aea91c10110a0e3bb23117fc014730440220647d2dc5b15f60bc37dc42618a370b2a1490293f9e5c8464f53ec4fe1dfe067302203598773895b4b16d37485cbe21b337f4e4b650739880098c592553add7dd4355016952210375e00eb72e29da82b89367947f29ef34afb75e8654f6ea368e0acdfd92976b7c2103a1b26313f430c4b15bb1fdce663207659d8cac749a0e53d70eff01874496feff2103c96d495bfdd5ba4145e3e046fee45e84a8a48ad05bd8dbb395c011a32cf9f88053ae00000000",
         0,
     )
+
+
+def test_verify_inputs(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    entry = chain_man.get_active_chain().block_tree_entries[202]
+    block = chain_man.blocks[entry]
+    undo = chain_man.block_spent_outputs[entry]
+    flags = pbk.ScriptVerificationFlags.ALL
+    script_check_queue = pbk.ScriptCheckQueue(2)
+
+    # The coinbase transaction has no undo data, so skip it
+    for tx, tx_undo in zip(list(block.transactions)[1:], undo.transactions):
+        spent_outputs = [coin.output for coin in tx_undo.coins]
+        expected = [True] * len(tx.inputs)
+        assert tx.verify_inputs(spent_outputs, flags) == expected
+        assert tx.verify_inputs(spent_outputs, flags, script_check_queue) == expected
+
+    tx = block.transactions[1]
+    spent_outputs = [coin.output for coin in undo.transactions[0].coins]
+    wrong_amount = pbk.TransactionOutput(
+        spent_outputs[0].script_pubkey, spent_outputs[0].amount - 1
+    )
+    results = tx.verify_inputs([wrong_amount, *spent_outputs[1:]], flags)
+    assert results[0] is False
+    assert all(results[1:])
+
+    with pytest.raises(pbk.ScriptVerifyException) as excinfo:
+        tx.verify_inputs(spent_outputs + spent_outputs, flags)
+    assert excinfo.value.status == pbk.ScriptVerifyStatus.ERROR_SPENT_OUTPUTS_MISMATCH
+
+
+def test_signature_cache(chainman_regtest: pbk.ChainstateManager) -> None:
+    chain_man = chainman_regtest
+    entry = chain_man.get_active_chain().block_tree_entries[202]
+    block = chain_man.blocks[entry]
+    undo = chain_man.block_spent_outputs[entry]
+    flags = pbk.ScriptVerificationFlags.ALL
+    signature_cache = pbk.SignatureCache(1 << 20, 1 << 20)
+
+    tx_count = len(block.transactions) - 1
+    for expected_hits in (0, tx_count):
+        for tx, tx_undo in zip(list(block.transactions)[1:], undo.transactions):
+            spent_outputs = [coin.output for coin in tx_undo.coins]
+            results = tx.verify_inputs(
+                spent_outputs, flags, signature_cache=signature_cache
+            )
+            assert all(results)
+        # The second pass skips every transaction through the script
+        # execution cache
+        assert signature_cache.hits == expected_hits
+
+    # A cached transaction is still rejected with different spent outputs
+    tx = block.transactions[1]
+    spent_outputs = [coin.output for coin in undo.transactions[0].coins]
+    wrong_amount = pbk.TransactionOutput(
+        spent_outputs[0].script_pubkey, spent_outputs[0].amount - 1
+    )
+    results = tx.verify_inputs(
+        [wrong_amount, *spent_outputs[1:]], flags, signature_cache=signature_cache
+    )
+    assert results[0] is False
+
+    # The input's signature was cached while verifying the transaction
+    hits = signature_cache.hits
+    txdata = pbk.PrecomputedTransactionData(tx, spent_outputs)
+    assert spent_outputs[0].script_pubkey.verify(
+        spent_outputs[0].amount, tx, txdata, 0, flags, signature_cache
+    )
+    assert signature_cache.hits > hits
+
+    # Signatures are cached for inputs verified one at a time too, also
+    # under the full flag set for a transaction without taproot spends
+    signature_cache = pbk.SignatureCache(1 << 20, 1 << 20)
+    for expected_hits in (0, 1):
+        assert spent_outputs[0].script_pubkey.verify(
+            spent_outputs[0].amount, tx, txdata, 0, flags, signature_cache
+        )
+        assert signature_cache.hits == expected_hits
+    assert not wrong_amount.script_pubkey.verify(
+        wrong_amount.amount, tx, txdata, 0, flags, signature_cache
+    )
+
+
+def test_signature_cache_missing_taproot_data() -> None:
+    # A taproot key path spend, verified against precomputed data whose spent
+    # outputs contain no taproot output, lacks the data to compute the sighash.
+    taproot = pbk.ScriptPubkey(bytes.fromhex("5120" + "11" * 32))
+    p2wpkh = pbk.TransactionOutput(
+        pbk.ScriptPubkey(bytes.fromhex("0014" + "22" * 20)), 1000
+    )
+    tx = pbk.Transaction(
+        bytes.fromhex(
+            "02000000" "0001" "01" + "00" * 32 + "00000000" "00" "ffffffff"
+            "01" "e803000000000000" "22" "5120" + "11" * 32 +
+            "01" "40" + "00" * 64 + "00000000"
+        )
+    )
+    txdata = pbk.PrecomputedTransactionData(tx, [p2wpkh])
+    flags = pbk.ScriptVerificationFlags.ALL
+    signature_cache = pbk.SignatureCache(1 << 20, 1 << 20)
+    assert not taproot.verify(1000, tx, txdata, 0, flags)
+    assert not taproot.verify(1000, tx, txdata, 0, flags, signature_cache)
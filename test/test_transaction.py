@@ -1,7 +1,12 @@
+import ctypes
 import gc
 import weakref
 
+import pytest
+
 import pbk
+import pbk.capi.bindings as k
+from pbk.writer import ByteWriter, write_to_buffer
 
 
 SAMPLE_TX_HEX = "010000000320ad43984a790ca5a964904686b8e17732ccf9d0d5f679f7675623e971890385010000006b483045022100ad4777681f360e7791d3f866006415b6511723abbd75a318c5a91c951122c03602202a5eadc8054dbf1d269a6b17c116bac42b4c110da693f2226a0ef7fcd659395f0121026de67c5ce81b6adf330ac6201a7339efa5503a49f1bf95a88c89e214a62dcac8feffffffcbe2144e8fad7e1e1cc270f7dbc75f64f961a5279696160e4a108bd84ebe5ca0ba0200006a47304402204eeb81c63817e960e7854393f64b212480d2dfc0be583601b0702251e5a63de002200b2f37228768a0547ea037ac47e2d948c411c4fdd2ab74f6f21d6805a5a380fb01210364492cd3a5a9365dcb46bb509381ec002052ee8df5a89d6192747c6eb15fe32dfeffffff08ef4370f8930e28110fc172475e42adf9bb0c11cf764e2c61b536a314946f76010000006a47304402203455335b54e31b0dcb82340e8ad7a4ef583da1923e0d2a9628d5728f5258c058022030d0134897a2f8d7303d3abfdd6a08c593acbb0b91d43287af4ac909e7ebf7bd01210267a46854fe5c0ac26049eb48b95cbfce7cc1e3f6baf540f3c8d3b80fda65bc53feffffff0240420f00000000001976a9140542e43d197f1a2e525d02e95ab70a2517e625a888acf9430f00000000001976a914b6bc75e3a6e8be9a86caab8cbeebb640d7468d4388ac9f680600"
@@ -21,12 +26,13 @@ def test_transaction() -> None:
     assert txid == txid
     assert txid != 0
 
-    # Test Txid __repr__ - shows internal format (not evaluable since Txid can't be constructed)
+    # Test Txid __repr__
     # Note: bytes.__repr__() shows printable ASCII directly (L=\x4c, X=\x58, &=\x26)
     assert (
         repr(txid)
         == "Txid(b'UL\\x99\\xd3\\xcf1\\xd4$\\x1c\\x81\\r\\xe9\\x03\\x05C\\x03\\xc3\\xb4\\xf6\\xfb\\x9e5\\x81iX(U&f\\xbd\\xba\\x9a')"
     )
+    assert pbk.Txid(bytes(txid)) == txid
 
     # TransactionInput & TransactionOutPoint
     inputs_expected_results = [
@@ -87,6 +93,26 @@ def test_transaction() -> None:
         assert tx_input.sequence == 0xFFFFFFFE
 
 
+def test_transaction_to_buffer() -> None:
+    ser_tx = bytes.fromhex(SAMPLE_TX_HEX)
+    tx = pbk.Transaction(ser_tx)
+    size = k.btck_transaction_serialized_size(tx)
+    assert size == len(ser_tx)
+    assert ByteWriter().write(k.btck_transaction_to_bytes, tx) == ser_tx
+
+    buffer = ctypes.create_string_buffer(size)
+    assert k.btck_transaction_to_buffer(tx, buffer, size) == 0
+    assert buffer.raw == ser_tx
+    assert k.btck_transaction_to_buffer(tx, buffer, size - 1) != 0
+
+    with pytest.raises(RuntimeError):
+        write_to_buffer(
+            lambda tx: k.btck_transaction_serialized_size(tx) - 1,
+            k.btck_transaction_to_buffer,
+            tx,
+        )
+
+
 def test_transaction_input_sequence_per_input() -> None:
     # Three inputs with three distinct nSequence values, to verify the
     # wrapper reads each input's own sequence rather than always
@@ -1,3 +1,6 @@
+import ctypes
+import threading
+from collections.abc import Callable
 from pathlib import Path
 
 import pytest
@@ -82,6 +85,65 @@ def test_validation_callbacks_wrap_block_and_entry(temp_dir: Path) -> None:
         assert isinstance(block_arg.block_hash, pbk.BlockHash)
 
 
+def test_validation_callbacks_borrow_blocks(temp_dir: Path) -> None:
+    hashes: list[pbk.BlockHash] = []
+    borrowed: list[pbk.Block] = []
+    borrowed_txs: list[pbk.Transaction] = []
+    detached: list[pbk.Block] = []
+    detached_txs: list[pbk.Transaction] = []
+
+    def on_connected(block: pbk.Block, entry: pbk.BlockTreeEntry) -> None:
+        hashes.append(block.block_hash)
+        if len(hashes) == 1:
+            # Keep the genesis block borrowed
+            borrowed.append(block)
+            borrowed_txs.append(block.transactions[0])
+            return
+        # Taken before detaching, so it still points into the borrowed block
+        borrowed_txs.append(block.transactions[0])
+        detached_txs.append(block.transactions[0].detach())
+        # Detaching promotes the block itself to an owned copy
+        assert block.detach() is block
+        detached.append(block)
+
+    # Borrowed blocks are passed through the borrowed callbacks, which are
+    # not settable directly
+    callbacks = pbk.ValidationInterfaceCallbacks(
+        borrow_blocks=True, block_connected=on_connected
+    )
+    assert callbacks.borrowed_block_connected and not callbacks.block_connected
+    with pytest.raises(ValueError, match="not recognized"):
+        pbk.ValidationInterfaceCallbacks(borrowed_block_connected=on_connected)
+
+    cm = pbk.load_chainman(temp_dir, pbk.ChainType.REGTEST, callbacks)
+    with (Path(__file__).parent / "data" / "regtest" / "blocks.txt").open() as f:
+        block = pbk.Block(bytes.fromhex(f.readline().strip()))
+    assert cm.process_block(block)
+    assert block.detach() is block
+    assert [b.block_hash for b in detached] == hashes[1:]
+    assert detached[-1].block_hash == block.block_hash
+
+    # The borrowed block and views into it, including views taken from a
+    # block before it was detached, raise instead of accessing freed memory
+    for tx in borrowed_txs:
+        for use in (lambda: tx.txid, lambda: bytes(tx), lambda: tx.detach()):
+            with pytest.raises(ctypes.ArgumentError, match="no longer valid"):
+                use()
+    for use in (
+        lambda: borrowed[0].block_hash,
+        lambda: len(borrowed[0].transactions),
+        lambda: bytes(borrowed[0]),
+        lambda: borrowed[0].detach(),
+    ):
+        with pytest.raises(ctypes.ArgumentError, match="no longer valid"):
+            use()
+
+    # The detached block itself, and views into it, stay usable
+    assert bytes(detached[-1]) == bytes(block)
+    assert bytes(detached_txs[-1]) == bytes(detached[-1].transactions[0])
+    assert detached[-1].transactions[0].txid == block.transactions[0].txid
+
+
 def test_validation_callbacks_wrap_block_and_state(temp_dir: Path) -> None:
     received: list[tuple[str, str, pbk.ValidationMode]] = []
 
@@ -104,3 +166,72 @@ def test_validation_callbacks_wrap_block_and_state(temp_dir: Path) -> None:
         assert block_type == "Block"
         assert state_type == "BlockValidationState"
         assert mode == pbk.ValidationMode.VALID
+
+
+def _queued_context(
+    callbacks: pbk.ValidationInterfaceCallbacks,
+    capacity: int,
+    overflow: pbk.ValidationQueueOverflow,
+) -> pbk.Context:
+    opts = pbk.ContextOptions()
+    opts.set_chainparams(pbk.ChainParameters(pbk.ChainType.REGTEST))
+    opts.set_validation_interface(callbacks)
+    opts.set_validation_interface_queue(capacity, overflow)
+    return pbk.Context(opts)
+
+
+def test_validation_interface_queue(
+    make_chainman: Callable[..., pbk.ChainstateManager],
+    regtest_blocks: list[pbk.Block],
+) -> None:
+    with pytest.raises(ValueError):
+        pbk.ContextOptions().set_validation_interface_queue(0)
+
+    blocks = regtest_blocks
+
+    events: list[tuple[str, int]] = []
+    modes: list[pbk.ValidationMode] = []
+
+    def on_checked(block: pbk.Block, state: pbk.BlockValidationState) -> None:
+        modes.append(state.validation_mode)
+
+    context = _queued_context(
+        pbk.ValidationInterfaceCallbacks(
+            block_checked=on_checked,
+            block_connected=lambda b, e: events.append(("connected", e.height)),
+        ),
+        capacity=4,
+        overflow=pbk.ValidationQueueOverflow.BLOCK,
+    )
+    cm = make_chainman(context, blocks=blocks)
+    context.sync_validation_interface_queue()
+    # Nothing is dropped, and callbacks arrive in order, starting with genesis
+    assert events == [("connected", height) for height in range(len(blocks) + 1)]
+    assert modes == [pbk.ValidationMode.VALID] * (len(blocks) + 1)
+
+    # Hold up the genesis callback until all blocks were processed
+    holding = threading.Event()
+    release = threading.Event()
+    connected: list[int] = []
+
+    def on_connected(block: pbk.Block, entry: pbk.BlockTreeEntry) -> None:
+        holding.set()
+        release.wait(timeout=60)
+        connected.append(entry.height)
+
+    context = _queued_context(
+        pbk.ValidationInterfaceCallbacks(block_connected=on_connected),
+        capacity=2,
+        overflow=pbk.ValidationQueueOverflow.DROP_OLDEST,
+    )
+    cm = make_chainman(context)
+    assert holding.wait(timeout=60)
+    for block in blocks:
+        assert cm.process_block(block)
+    assert cm.get_active_chain().height == len(blocks)
+    release.set()
+    context.sync_validation_interface_queue()
+    # The queue also holds validation events without a registered callback
+    assert connected[0] == 0
+    assert connected[-1] == len(blocks)
+    assert len(connected) <= 3